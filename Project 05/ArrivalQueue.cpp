@@ -0,0 +1,61 @@
+/**
+ * @file	ArrivalQueue.cpp
+ * @brief	Implementation of ArrivalQueue class
+ * @author	Wei Tong
+ * @details All members of ArrivalQueue are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires ArrivalQueue.h
+ */
+
+#include "ArrivalQueue.h"
+
+// Starts with an empty node that tail points at
+ArrivalQueue::ArrivalQueue(){
+	node* stub = new node;
+	stub->next.store(NULL);
+	stub->batch = NULL;
+	head.store(stub);
+	tail = stub;
+	doorbell.store(false);
+}
+
+ArrivalQueue::~ArrivalQueue(){
+	Workload* batch;
+	while(pop(batch)){
+		delete batch;
+	}
+	delete tail;
+}
+
+// Takes the head slot first, then links the old head to the new node.
+// Until the link lands pop sees the queue end at the old head
+void ArrivalQueue::push(Workload* batch){
+	node* added = new node;
+	added->next.store(NULL, std::memory_order_relaxed);
+	added->batch = batch;
+	node* prev = head.exchange(added, std::memory_order_acq_rel);
+	prev->next.store(added, std::memory_order_release);
+}
+
+// The popped node becomes the new tail, its batch already handed out
+bool ArrivalQueue::pop(Workload* &batch){
+	node* next = tail->next.load(std::memory_order_acquire);
+	if(next == NULL)
+		return false;
+	batch = next->batch;
+	delete tail;
+	tail = next;
+	return true;
+}
+
+bool ArrivalQueue::claimDoorbell(){
+	return !doorbell.exchange(true, std::memory_order_acq_rel);
+}
+
+// An exchange rather than a store, so a pusher that found the doorbell
+// already rung has its push seen by the drain that follows
+void ArrivalQueue::clearDoorbell(){
+	doorbell.exchange(false, std::memory_order_acq_rel);
+}
@@ -0,0 +1,45 @@
+/**
+ * @file	ArrivalQueue.h
+ * @brief	Definition file for ArrivalQueue class
+ * @author	Wei Tong
+ * @details Specifies all members of ArrivalQueue class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, hands newly loaded processes
+ *			to the simulator without a lock
+ */
+
+#ifndef ARRIVALQUEUE_H
+#define ARRIVALQUEUE_H
+
+#include "Workload.h"
+#include <atomic>
+
+// Lock free queue of arriving workloads, any number of threads push and
+// the simulator alone pops. A push is one atomic exchange, so arrivals
+// never wait on each other or on the simulator.
+//
+// The simulator sleeps on the event queue, so pushers also share one
+// doorbell: the pusher that finds it unrung rings the event queue, and
+// the simulator clears it before draining. Arrivals in between ride on
+// that one ring, so a burst costs a single wake up
+class ArrivalQueue{
+private:
+	struct node{
+		std::atomic<node*> next;
+		Workload* batch;
+	};
+
+	std::atomic<node*> head;	// Last node pushed
+	node* tail;					// Simulator only, node before the next to pop
+	std::atomic<bool> doorbell;	// The simulator has been woken for the queue
+public:
+	ArrivalQueue();							// Default constructor
+	~ArrivalQueue();						// Deletes anything not popped
+	void push(Workload*);					// Any thread, NULL marks a failed load
+	bool pop(Workload* &);					// Simulator only, false when empty
+	bool claimDoorbell();					// Any thread, after push, true if it must ring
+	void clearDoorbell();					// Simulator only, before draining
+};
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file	CfsPolicy.cpp
+ * @brief	Implementation of CfsPolicy class
+ * @author	Wei Tong
+ * @details All members of CfsPolicy are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires CfsPolicy.h
+ */
+
+#include "CfsPolicy.h"
+
+// Weight of each nice value from -20 to 19, nice 0 weighs 1024 and
+// each step is about 10% more or less processor time
+static const int niceWeight[40] = {
+	88761, 71755, 56483, 46273, 36291,
+	29154, 23254, 18705, 14949, 11916,
+	9548, 7620, 6100, 4904, 3906,
+	3121, 2501, 1991, 1586, 1277,
+	1024, 820, 655, 526, 423,
+	335, 272, 215, 172, 137,
+	110, 87, 70, 56, 45,
+	36, 29, 23, 18, 15
+};
+
+void CfsPolicy::setup(simState &sim, ConfData &schConf){
+	granularity = schConf.get_pqn();
+	tree.assign(sim.cores.size(), runTree());
+	minVruntime.assign(sim.cores.size(), 0);
+}
+
+// Virtual runtime of usec of processor time at a nice value
+long long CfsPolicy::weighted(int nice, long long usec){
+	return usec * 1024 / niceWeight[nice + 20];
+}
+
+// A new process starts level with the core it is dealt to, so it
+// neither waits behind everybody nor takes over the core
+void CfsPolicy::onArrival(simState &sim, int proc){
+	vruntime.resize(sim.procs.size(), 0);
+	vruntime[proc] = minVruntime[sim.nextCore];
+}
+
+// A process back from I/O is not owed the time it spent blocked
+void CfsPolicy::enqueue(simState &sim, int core, int proc){
+	if(vruntime[proc] < minVruntime[core])
+		vruntime[proc] = minVruntime[core];
+	tree[core].insert(std::make_pair(vruntime[proc], proc));
+}
+
+int CfsPolicy::pickNext(simState &sim, int core){
+
+	if(tree[core].empty())
+		return -1;
+	int proc = tree[core].begin()->second;
+	tree[core].erase(tree[core].begin());
+	if(vruntime[proc] > minVruntime[core])
+		minVruntime[core] = vruntime[proc];
+	return proc;
+}
+
+int CfsPolicy::waiting(int core){
+	return tree[core].size();
+}
+
+// Takes the process with the most vruntime, the one its own core
+// would run last
+int CfsPolicy::steal(simState &sim, int core){
+
+	if(tree[core].empty())
+		return -1;
+	runTree::iterator last = --tree[core].end();
+	int proc = last->second;
+	tree[core].erase(last);
+	return proc;
+}
+
+// Without a processor quantum CFS runs processing actions to the end
+int CfsPolicy::quantum(simState &sim, int proc){
+	return granularity > 0 ? granularity : 0;
+}
+
+void CfsPolicy::charge(simState &sim, int proc, int msec){
+	vruntime[proc] += weighted(sim.procs[proc].nice, (long long)msec * 1000);
+}
+
+// Virtual runtime of the process running on a core, counting the
+// part of its current slice that has already gone by
+long long CfsPolicy::vruntimeNow(simState &sim, int core){
+
+	int proc = sim.cores[core].running;
+	long long elapsed = sim.clock->now() - sim.cores[core].busySince;
+	if(elapsed > (long long)sim.procs[proc].sliceLen * 1000)
+		elapsed = (long long)sim.procs[proc].sliceLen * 1000;
+	return vruntime[proc] + weighted(sim.procs[proc].nice, elapsed);
+}
+
+// A process that becomes ready takes over the core running the most
+// vruntime if it is behind that by more than a slice
+int CfsPolicy::preemptTarget(simState &sim, int proc){
+
+	int victim = -1;
+	long long most = -1;
+	for(unsigned int core = 0; core < sim.cores.size(); core++){
+		int running = sim.cores[core].running;
+
+		// An idle core will pick the process up anyway
+		if(running == -1)
+			return -1;
+
+		// Only processing actions can be interrupted
+		if(currentOp(sim, running).getCode() != 'P')
+			continue;
+		long long now = vruntimeNow(sim, core);
+		if(now > most){
+			most = now;
+			victim = core;
+		}
+	}
+	if(victim == -1)
+		return -1;
+
+	long long start = vruntime[proc];
+	if(start < minVruntime[victim])
+		start = minVruntime[victim];
+	if(start + (long long)granularity * 1000 >= most)
+		return -1;
+	return victim;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file	CfsPolicy.h
+ * @brief	Definition file for CfsPolicy class
+ * @author	Wei Tong
+ * @details Specifies all members of CfsPolicy class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, completely fair scheduling
+ */
+
+#ifndef CFSPOLICY_H
+#define CFSPOLICY_H
+
+#include "SchPolicy.h"
+#include <set>
+#include <utility>
+#include <vector>
+
+// Completely fair scheduling. Every process collects virtual runtime,
+// the time it ran scaled down by its weight, and each core runs the
+// ready process with the least of it. Weights come from the A{nice}
+// value of the process. Ready processes sit in a balanced tree per
+// core, so inserting and picking the next one is O(log n)
+class CfsPolicy : public SchPolicy{
+private:
+	typedef std::set<std::pair<long long, int>> runTree;	// (vruntime, process)
+
+	int granularity;				// Slice length in msec, the processor quantum
+	std::vector<runTree> tree;		// Ready processes of each core
+	std::vector<long long> minVruntime;	// Smallest vruntime each core has run
+	std::vector<long long> vruntime;	// Weighted microseconds each process has run
+
+	long long weighted(int, long long);
+	long long vruntimeNow(simState &, int);
+public:
+	static const bool PREEMPTIVE = true;
+	static const bool STREAMS = false;
+	void setup(simState &, ConfData &);
+	void onArrival(simState &, int);
+	void enqueue(simState &, int, int);
+	int pickNext(simState &, int);
+	int waiting(int);
+	int steal(simState &, int);
+	int quantum(simState &, int);
+	void charge(simState &, int, int);
+	int preemptTarget(simState &, int);
+};
+
+#endif
@@ -38,6 +38,29 @@ ConfData::ConfData(){
 	// v4.0
 	pqn = -1;
 	sch_type = "";
+
+	// v6.0
+	clock_type = "Real";	// Optional, runs against the wall clock by default
+	timer_type = "Hybrid";	// Optional, sleeps then spins a short tail
+	spin_tail = 200;
+	sim_speed = 1;	// Optional, real runs take their full length by default
+	num_cores = 1;	// Optional, single processor by default
+	sch_key = "Operations";	// Optional, ranks by operation count by default
+	mlfq_levels = 3;	// Optional, MLFQ only
+	mlfq_boost = 1000;
+	ps_aging = 500;	// Optional, PS only
+	reloads = 0;	// Optional, the meta data file is loaded once by default
+	reload_interval = 100;
+	load_procs = 0;	// Optional, no generated load by default
+	load_shape = "Poisson";
+	load_rate = 10;
+	burst_on = 100;
+	burst_off = 100;
+	diurnal_period = 1000;
+	diurnal_swing = 50;
+	load_ops = 4;
+	load_cycles = 5;
+	stream_window = 0;	// Optional, the meta data file is loaded whole by default
 }
 
 // Default deconstructor, nothing to deallocate
@@ -154,6 +177,40 @@ int ConfData::readLine(std::string inptLine){
 		// std::cout << "Read in log file path is: " << logPath << std::endl;
 		return 0;
 	}
+	// v6.0, an offset and a path, may be given more than once
+	else if(!cycleType.compare("Arrival File Path {msec}")){
+		convertText = inptLine.substr(inptLine.find_first_of(":"));
+		convertText.erase(0,2);	// Remove the ": "
+		std::istringstream buffer(convertText);
+		int offset;
+		if(!(buffer >> offset) || offset < 0)
+			return 2;
+		buffer >> std::ws;
+		std::string path;
+		if(!getline(buffer, path))
+			return 2;
+		add_arrival(offset, path);
+		return 0;
+	}
+	// v6.0, a comma separated list of operations and weights, such as
+	// "run 6, hard drive 2, monitor 1"
+	else if(!cycleType.compare("Load mix")){
+		convertText = inptLine.substr(inptLine.find_first_of(":"));
+		convertText.erase(0,2);	// Remove the ": "
+		std::istringstream entries(convertText);
+		std::string entry;
+		while(getline(entries, entry, ',')){
+			std::size_t split = entry.find_last_of(" ");
+			if(split == std::string::npos)
+				return 2;
+			std::size_t start = entry.find_first_not_of(" ");
+			std::istringstream buffer(entry.substr(split + 1));
+			int weight;
+			if(!(buffer >> weight) || weight < 0 || split <= start || !add_mix(entry.substr(start, split - start), weight))
+				return 2;
+		}
+		return 0;
+	}
 	else if(inptLine.find_first_of("1234567890") == std::string::npos){
 		convertText = inptLine.substr(inptLine.find_first_of(":"));
 		convertText.erase(0,2);	// Remove the ": "
@@ -246,17 +303,95 @@ int ConfData::readLine(std::string inptLine){
 		pqn = inptNum;
 	}
 
+	// v6.0, any code is taken, main checks it against the
+	// scheduling policies the simulator was built with
 	else if(!cycleType.compare("CPU Scheduling Code")){
-		if(!convertText.compare("FIFO"))
-			sch_type = convertText;
-		else if(!convertText.compare("PS"))
-			sch_type = convertText;
-		else if(!convertText.compare("SJF"))
-			sch_type = convertText;
-		else if(!convertText.compare("RR"))
-			sch_type = convertText;
-		else if(!convertText.compare("STR"))
-			sch_type = convertText;
+		sch_type = convertText;
+	}
+
+	// v6.0
+	else if(!cycleType.compare("Simulation Clock")){
+		if(!convertText.compare("Real") || !convertText.compare("Virtual"))
+			clock_type = convertText;
+		else
+			return 2;
+	}
+	else if(!cycleType.compare("Timer Mode")){
+		if(!convertText.compare("Spin") || !convertText.compare("Hybrid") || !convertText.compare("Sleep"))
+			timer_type = convertText;
+		else
+			return 2;
+	}
+	else if(!cycleType.compare("Timer spin tail {usec}")){
+		spin_tail = inptNum;
+	}
+	else if(!cycleType.compare("Simulation speed multiplier")){
+		sim_speed = inptNum;
+	}
+	else if(!cycleType.compare("Processor cores")){
+		num_cores = inptNum;
+	}
+	else if(!cycleType.compare("MLFQ levels")){
+		mlfq_levels = inptNum;
+	}
+	else if(!cycleType.compare("MLFQ boost period {msec}")){
+		mlfq_boost = inptNum;
+	}
+	else if(!cycleType.compare("Priority aging {msec}")){
+		ps_aging = inptNum;
+	}
+	else if(!cycleType.compare("Meta-Data reloads")){
+		reloads = inptNum;
+	}
+	else if(!cycleType.compare("Meta-Data reload interval {msec}")){
+		reload_interval = inptNum;
+	}
+	else if(!cycleType.compare("Meta-Data stream window {processes}")){
+		stream_window = inptNum;
+	}
+	else if(!cycleType.compare("Load processes")){
+		load_procs = inptNum;
+	}
+	else if(!cycleType.compare("Load arrivals")){
+		if(!convertText.compare("Poisson") || !convertText.compare("Bursty") || !convertText.compare("Diurnal"))
+			load_shape = convertText;
+		else
+			return 2;
+	}
+	else if(!cycleType.compare("Load rate {per sec}")){
+		load_rate = inptNum;
+	}
+	else if(!cycleType.compare("Load burst on {msec}")){
+		burst_on = inptNum;
+	}
+	else if(!cycleType.compare("Load burst off {msec}")){
+		burst_off = inptNum;
+	}
+	else if(!cycleType.compare("Load diurnal period {msec}")){
+		diurnal_period = inptNum;
+	}
+	else if(!cycleType.compare("Load diurnal swing {percent}")){
+		if(inptNum > 100)
+			return 2;
+		diurnal_swing = inptNum;
+	}
+	else if(!cycleType.compare("Load operations")){
+		load_ops = inptNum;
+	}
+	else if(!cycleType.compare("Load cycles")){
+		load_cycles = inptNum;
+	}
+	// v6.0, "Scheduling key" sets every policy, "Scheduling key SJF"
+	// only the one with that code
+	else if(!cycleType.compare(0, 14, "Scheduling key")){
+		if(convertText.compare("Operations") && convertText.compare("Time"))
+			return 2;
+		if(!cycleType.compare("Scheduling key"))
+			sch_key = convertText;
+		else if(cycleType[14] == ' ' && cycleType.length() > 15)
+			set_policy_key(cycleType.substr(15), convertText);
+		else
+			return 2;
 	}
 
 	else
@@ -397,6 +532,28 @@ bool ConfData::readStatus(){
 		programStatus = false;
 	}
 
+	// v6.0
+	if(sim_speed == 0){
+		std::cout << "Error: simulation speed multiplier is zero" << std::endl;
+		programStatus = false;
+	}
+	if(num_cores == 0){
+		std::cout << "Error: number of processor cores is zero" << std::endl;
+		programStatus = false;
+	}
+	if(mlfq_levels == 0){
+		std::cout << "Error: number of MLFQ levels is zero" << std::endl;
+		programStatus = false;
+	}
+	if(mlfq_levels > MLFQ_MAX_LEVELS){
+		std::cout << "Error: number of MLFQ levels is more than " << MLFQ_MAX_LEVELS << std::endl;
+		programStatus = false;
+	}
+	if(load_procs > 0 && (load_rate == 0 || burst_on == 0 || diurnal_period == 0 || load_ops == 0 || load_cycles == 0)){
+		std::cout << "Error: load generator rate, burst, period, operations or cycles is zero" << std::endl;
+		programStatus = false;
+	}
+
 	return programStatus;
 }
 
@@ -452,4 +609,211 @@ void ConfData::set_sch(std::string inpt_sch){
 
 std::string ConfData::get_sch(){
 	return sch_type;
-}
\ No newline at end of file
+}
+
+// v6.0
+
+void ConfData::set_clock(std::string inpt_clock){
+	clock_type = inpt_clock;
+}
+
+std::string ConfData::get_clock(){
+	return clock_type;
+}
+
+void ConfData::set_timer(std::string inpt_timer){
+	timer_type = inpt_timer;
+}
+
+std::string ConfData::get_timer(){
+	return timer_type;
+}
+
+void ConfData::set_spin_tail(int inpt_tail){
+	spin_tail = inpt_tail;
+}
+
+int ConfData::get_spin_tail(){
+	return spin_tail;
+}
+
+void ConfData::set_speed(float inpt_speed){
+	sim_speed = inpt_speed;
+}
+
+float ConfData::get_speed(){
+	return sim_speed;
+}
+
+void ConfData::set_cores(int inpt_cores){
+	num_cores = inpt_cores;
+}
+
+int ConfData::get_cores(){
+	return num_cores;
+}
+
+void ConfData::set_sch_key(std::string inpt_key){
+	sch_key = inpt_key;
+}
+
+void ConfData::set_policy_key(std::string inpt_code, std::string inpt_key){
+	policy_keys[inpt_code] = inpt_key;
+}
+
+std::string ConfData::get_sch_key(std::string code){
+	std::map<std::string, std::string>::iterator it = policy_keys.find(code);
+	if(it == policy_keys.end())
+		return sch_key;
+	return it->second;
+}
+
+void ConfData::set_mlfq_levels(int inpt_levels){
+	mlfq_levels = inpt_levels;
+}
+
+int ConfData::get_mlfq_levels(){
+	return mlfq_levels;
+}
+
+void ConfData::set_mlfq_boost(int inpt_boost){
+	mlfq_boost = inpt_boost;
+}
+
+int ConfData::get_mlfq_boost(){
+	return mlfq_boost;
+}
+
+void ConfData::set_ps_aging(int inpt_aging){
+	ps_aging = inpt_aging;
+}
+
+int ConfData::get_ps_aging(){
+	return ps_aging;
+}
+
+void ConfData::add_arrival(int inpt_at, std::string inpt_path){
+	arrival_at.push_back(inpt_at);
+	arrival_path.push_back(inpt_path);
+}
+
+int ConfData::get_arrivals(){
+	return arrival_at.size();
+}
+
+int ConfData::get_arrival_at(int index){
+	return arrival_at[index];
+}
+
+std::string ConfData::get_arrival_path(int index){
+	return arrival_path[index];
+}
+
+void ConfData::set_reloads(int inpt_reloads, int inpt_interval){
+	reloads = inpt_reloads;
+	reload_interval = inpt_interval;
+}
+
+int ConfData::get_reloads(){
+	return reloads;
+}
+
+int ConfData::get_reload_interval(){
+	return reload_interval;
+}
+
+void ConfData::set_load_procs(int inpt_procs){
+	load_procs = inpt_procs;
+}
+
+int ConfData::get_load_procs(){
+	return load_procs;
+}
+
+void ConfData::set_load_shape(std::string inpt_shape){
+	load_shape = inpt_shape;
+}
+
+std::string ConfData::get_load_shape(){
+	return load_shape;
+}
+
+void ConfData::set_load_rate(float inpt_rate){
+	load_rate = inpt_rate;
+}
+
+float ConfData::get_load_rate(){
+	return load_rate;
+}
+
+void ConfData::set_burst(int inpt_on, int inpt_off){
+	burst_on = inpt_on;
+	burst_off = inpt_off;
+}
+
+int ConfData::get_burst_on(){
+	return burst_on;
+}
+
+int ConfData::get_burst_off(){
+	return burst_off;
+}
+
+void ConfData::set_diurnal(int inpt_period, int inpt_swing){
+	diurnal_period = inpt_period;
+	diurnal_swing = inpt_swing;
+}
+
+int ConfData::get_diurnal_period(){
+	return diurnal_period;
+}
+
+int ConfData::get_diurnal_swing(){
+	return diurnal_swing;
+}
+
+void ConfData::set_load_ops(int inpt_ops){
+	load_ops = inpt_ops;
+}
+
+int ConfData::get_load_ops(){
+	return load_ops;
+}
+
+void ConfData::set_load_cycles(int inpt_cycles){
+	load_cycles = inpt_cycles;
+}
+
+int ConfData::get_load_cycles(){
+	return load_cycles;
+}
+
+// Only operations a process can run are taken
+bool ConfData::add_mix(std::string inpt_desc, int inpt_weight){
+	if(inpt_desc != "run" && inpt_desc != "allocate" && inpt_desc != "block" && inpt_desc != "hard drive" &&
+		inpt_desc != "keyboard" && inpt_desc != "scanner" && inpt_desc != "monitor" && inpt_desc != "projector")
+		return false;
+	mix_desc.push_back(inpt_desc);
+	mix_weight.push_back(inpt_weight);
+	return true;
+}
+
+int ConfData::get_mixes(){
+	return mix_desc.size();
+}
+
+std::string ConfData::get_mix_desc(int index){
+	return mix_desc[index];
+}
+
+int ConfData::get_mix_weight(int index){
+	return mix_weight[index];
+}
+
+void ConfData::set_stream_window(int inpt_window){
+	stream_window = inpt_window;
+}
+
+int ConfData::get_stream_window(){
+	return stream_window;
+}
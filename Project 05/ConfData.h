@@ -10,14 +10,23 @@
  *			algorithm in new configuration files
  */
 
+#ifndef CONFDATA_H
+#define CONFDATA_H
+
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <vector>
+#include <map>
 
 #define Monitor 1
 #define File 2
 #define Both 3
 
+// v6.0, the MLFQ allotment doubles on each level, more than this would
+// shift a quantum past the range of an int
+#define MLFQ_MAX_LEVELS 16
+
 class ConfData{
 private:
 	float version;
@@ -44,6 +53,34 @@ private:
 	int pqn;	// Processor Quantum Number
 	std::string sch_type;	// Scheduling type (FIFO, PS, SJF)
 
+	// v6.0
+	std::string clock_type;	// Simulation clock (Real, Virtual)
+	std::string timer_type;	// Timer accuracy vs CPU mode (Spin, Hybrid, Sleep)
+	int spin_tail;	// Microseconds a hybrid wait spins before its deadline
+	float sim_speed;	// Time dilation, simulated time per unit of real time
+	int num_cores;	// Simulated processor cores
+	std::string sch_key;	// What schAlg ranks processes by (Operations, Time)
+	std::map<std::string, std::string> policy_keys;	// Scheduling key of a single policy, by code
+	int mlfq_levels;	// MLFQ priority levels
+	int mlfq_boost;	// Msec between MLFQ priority boosts, 0 for none
+	int ps_aging;	// Msec a PS process waits to gain one priority level, 0 for none
+	std::vector<int> arrival_at;	// Msec after the start each arrival file is loaded at
+	std::vector<std::string> arrival_path;	// Meta data file of each arrival
+	int reloads;	// Times the meta data file is loaded again as new processes, 0 for none
+	int reload_interval;	// Msec between reloads of the meta data file
+	int load_procs;	// Processes the load generator makes, 0 for none
+	std::string load_shape;	// Load generator arrivals (Poisson, Bursty, Diurnal)
+	float load_rate;	// Mean generated arrivals per second
+	int burst_on;	// Msec a Bursty generator is on for
+	int burst_off;	// Msec a Bursty generator is off for
+	int diurnal_period;	// Msec of one Diurnal cycle
+	int diurnal_swing;	// Percent a Diurnal rate swings above and below its mean
+	int load_ops;	// Mean operations of a generated process
+	int load_cycles;	// Mean cycles of a generated operation
+	std::vector<std::string> mix_desc;	// Operation of each load mix entry
+	std::vector<int> mix_weight;	// Relative weight of each load mix entry
+	int stream_window;	// Meta data processes held at once while streaming, 0 loads the whole file
+
 public:
 	ConfData();								// Default constructor
 	~ConfData();							// Default deconstructor
@@ -77,4 +114,56 @@ public:
 	int get_pqn();
 	void set_sch(std::string);
 	std::string get_sch();
-};
\ No newline at end of file
+
+	// v6.0
+	void set_clock(std::string);
+	std::string get_clock();
+	void set_timer(std::string);
+	std::string get_timer();
+	void set_spin_tail(int);
+	int get_spin_tail();
+	void set_speed(float);
+	float get_speed();
+	void set_cores(int);
+	int get_cores();
+	void set_sch_key(std::string);
+	void set_policy_key(std::string, std::string);
+	std::string get_sch_key(std::string);	// Key of the policy, or the one for every policy
+	void set_mlfq_levels(int);
+	int get_mlfq_levels();
+	void set_mlfq_boost(int);
+	int get_mlfq_boost();
+	void set_ps_aging(int);
+	int get_ps_aging();
+	void add_arrival(int, std::string);
+	int get_arrivals();
+	int get_arrival_at(int);
+	std::string get_arrival_path(int);
+	void set_reloads(int, int);
+	int get_reloads();
+	int get_reload_interval();
+	void set_load_procs(int);
+	int get_load_procs();
+	void set_load_shape(std::string);
+	std::string get_load_shape();
+	void set_load_rate(float);
+	float get_load_rate();
+	void set_burst(int, int);
+	int get_burst_on();
+	int get_burst_off();
+	void set_diurnal(int, int);
+	int get_diurnal_period();
+	int get_diurnal_swing();
+	void set_load_ops(int);
+	int get_load_ops();
+	void set_load_cycles(int);
+	int get_load_cycles();
+	bool add_mix(std::string, int);
+	int get_mixes();
+	std::string get_mix_desc(int);
+	int get_mix_weight(int);
+	void set_stream_window(int);
+	int get_stream_window();
+};
+
+#endif
@@ -0,0 +1,151 @@
+/**
+ * @file	EdfPolicy.cpp
+ * @brief	Implementation of EdfPolicy class
+ * @author	Wei Tong
+ * @details All members of EdfPolicy are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires EdfPolicy.h
+ */
+
+#include "EdfPolicy.h"
+#include <algorithm>
+#include <climits>
+#include <iomanip>
+#include <sstream>
+
+void EdfPolicy::setup(simState &sim, ConfData &schConf){
+	tree.assign(sim.cores.size(), deadlineTree());
+}
+
+void EdfPolicy::onArrival(simState &sim, int proc){
+
+	arrival.resize(sim.procs.size(), 0);
+	due.resize(sim.procs.size(), LLONG_MAX);
+	done.resize(sim.procs.size(), -1);
+	demand.resize(sim.procs.size(), 0);
+
+	simProcess &current = sim.procs[proc];
+	int relative = current.deadline > 0 ? current.deadline : current.period;
+	arrival[proc] = sim.clock->now();
+	if(relative > 0)
+		due[proc] = arrival[proc] + (long long)relative * 1000;
+	demand[proc] = sim.table.workLeft[proc];
+}
+
+void EdfPolicy::enqueue(simState &sim, int core, int proc){
+	tree[core].insert(std::make_pair(due[proc], proc));
+}
+
+int EdfPolicy::pickNext(simState &sim, int core){
+
+	if(tree[core].empty())
+		return -1;
+	int proc = tree[core].begin()->second;
+	tree[core].erase(tree[core].begin());
+	return proc;
+}
+
+int EdfPolicy::waiting(int core){
+	return tree[core].size();
+}
+
+// Takes the process due last, the one its own core would run last
+int EdfPolicy::steal(simState &sim, int core){
+
+	if(tree[core].empty())
+		return -1;
+	deadlineTree::iterator last = --tree[core].end();
+	int proc = last->second;
+	tree[core].erase(last);
+	return proc;
+}
+
+int EdfPolicy::preemptTarget(simState &sim, int proc){
+
+	int victim = -1;
+	long long latest = -1;
+	for(unsigned int core = 0; core < sim.cores.size(); core++){
+		int running = sim.cores[core].running;
+
+		// An idle core will pick the process up anyway
+		if(running == -1)
+			return -1;
+
+		// Only processing actions can be interrupted
+		if(currentOp(sim, running).getCode() != 'P')
+			continue;
+		if(due[running] > latest){
+			latest = due[running];
+			victim = core;
+		}
+	}
+	if(victim == -1 || due[proc] >= latest)
+		return -1;
+	return victim;
+}
+
+void EdfPolicy::onExit(simState &sim, int proc){
+	done[proc] = sim.clock->now();
+}
+
+// Deadline miss ratio, lateness distribution and the slack each process
+// with a deadline finished with, then the processor utilization of the
+// periodic processes against the number of cores
+void EdfPolicy::report(simState &sim){
+
+	std::vector<std::string> lines;
+	std::vector<long long> lateness;	// Msec past the deadline, negative when early
+	int misses = 0;
+	double utilization = 0;
+	for(unsigned int proc = 0; proc < due.size(); proc++){
+		if(sim.procs[proc].period > 0)
+			utilization += (double)demand[proc] / sim.procs[proc].period;
+		if(due[proc] == LLONG_MAX)
+			continue;
+
+		std::ostringstream line;
+		line << "Process " << sim.table.pid[proc] << ": deadline " << (due[proc] - arrival[proc]) / 1000 << " msec, ";
+		if(done[proc] == -1){
+			line << "not finished";
+			misses++;
+		}
+		else{
+			long long late = (done[proc] - due[proc]) / 1000;
+			lateness.push_back(late);
+			if(late > 0)
+				misses++;
+			line << "slack " << -late << " msec";
+		}
+		lines.push_back(line.str());
+	}
+
+	std::ostringstream summary;
+	int deadlines = lines.size();
+	double ratio = deadlines > 0 ? 100.0 * misses / deadlines : 0;
+	summary << "EDF: " << misses << " of " << deadlines << " deadlines missed, miss ratio "
+		<< std::fixed << std::setprecision(1) << ratio << "%";
+	lines.push_back(summary.str());
+
+	if(!lateness.empty()){
+		std::sort(lateness.begin(), lateness.end());
+		std::ostringstream spread;
+		spread << "EDF lateness: min " << lateness.front() << " msec, median " << percentile(lateness, 0.5)
+			<< " msec, 90th " << percentile(lateness, 0.9) << " msec, 99th " << percentile(lateness, 0.99)
+			<< " msec, max " << lateness.back() << " msec";
+		lines.push_back(spread.str());
+	}
+	if(utilization > 0){
+		std::ostringstream load;
+		load << "EDF: periodic utilization " << std::fixed << std::setprecision(2) << utilization << " on "
+			<< sim.cores.size() << (sim.cores.size() > 1 ? " cores, " : " core, ")
+			<< (utilization <= sim.cores.size() ? "within" : "over") << " capacity";
+		lines.push_back(load.str());
+	}
+
+	for(unsigned int i = 0; i < lines.size(); i++){
+		*sim.out1 << lines[i] << std::endl;
+		*sim.out2 << lines[i] << std::endl;
+	}
+}
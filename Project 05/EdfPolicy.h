@@ -0,0 +1,47 @@
+/**
+ * @file	EdfPolicy.h
+ * @brief	Definition file for EdfPolicy class
+ * @author	Wei Tong
+ * @details Specifies all members of EdfPolicy class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, Earliest Deadline First
+ */
+
+#ifndef EDFPOLICY_H
+#define EDFPOLICY_H
+
+#include "SchPolicy.h"
+#include <set>
+#include <utility>
+#include <vector>
+
+// Earliest Deadline First. A process's deadline is its arrival plus its
+// A{deadline}, or its A{period} when it has no deadline. Each core runs
+// the ready process due soonest, and a process that becomes ready takes
+// over the core running the one due last if it is due sooner. Processes
+// without either run after every process that has one, in arrival order
+class EdfPolicy : public SchPolicy{
+private:
+	typedef std::set<std::pair<long long, int>> deadlineTree;	// (due, process)
+
+	std::vector<deadlineTree> tree;		// Ready processes of each core
+	std::vector<long long> arrival;		// Simulated microseconds each process arrived at
+	std::vector<long long> due;			// Absolute deadline of each process, LLONG_MAX for none
+	std::vector<long long> done;		// When each process was removed, -1 while it runs
+	std::vector<long long> demand;		// Msec of processor and memory work of each process
+public:
+	static const bool PREEMPTIVE = true;
+	static const bool STREAMS = false;
+	void setup(simState &, ConfData &);
+	void onArrival(simState &, int);
+	void enqueue(simState &, int, int);
+	int pickNext(simState &, int);
+	int waiting(int);
+	int steal(simState &, int);
+	int preemptTarget(simState &, int);
+	void onExit(simState &, int);
+	void report(simState &);
+};
+
+#endif
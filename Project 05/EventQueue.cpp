@@ -0,0 +1,84 @@
+/**
+ * @file	EventQueue.cpp
+ * @brief	Implementation of EventQueue class
+ * @author	Wei Tong
+ * @details All members of EventQueue are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires EventQueue.h
+ */
+
+#include "EventQueue.h"
+
+EventQueue::EventQueue(SimClock* inptClock){
+	clock = inptClock;
+	nextSeq = 0;
+	outstanding = 0;
+	pthread_mutex_init(&eventLock, NULL);
+	pthread_cond_init(&eventReady, NULL);
+}
+
+EventQueue::~EventQueue(){
+	pthread_cond_destroy(&eventReady);
+	pthread_mutex_destroy(&eventLock);
+}
+
+void EventQueue::schedule(SimEvent inptEvent, int msec){
+	inptEvent.time = clock->now() + (long long)msec * 1000;
+	inptEvent.seq = nextSeq++;
+	timeline.push(inptEvent);
+	outstanding++;
+}
+
+// Only the simulator thread counts expected events, so this
+// does not need the lock
+void EventQueue::expect(){
+	outstanding++;
+}
+
+void EventQueue::post(SimEvent inptEvent){
+	inptEvent.time = clock->now();
+	pthread_mutex_lock(&eventLock);
+	inptEvent.seq = nextSeq++;
+	posted.push_back(inptEvent);
+	pthread_cond_signal(&eventReady);
+	pthread_mutex_unlock(&eventLock);
+}
+
+// Wakes the simulator for something outside the expected events,
+// it is not counted by empty()
+void EventQueue::ring(SimEvent inptEvent){
+	inptEvent.expected = false;
+	post(inptEvent);
+}
+
+// Caller must make sure an event is expected (!empty()), or on the
+// real clock that a thread will ring
+SimEvent EventQueue::next(){
+
+	SimEvent taken;
+
+	if(clock->isVirtual()){
+		outstanding--;
+		taken = timeline.top();
+		timeline.pop();
+		clock->advanceTo(taken.time);
+		return taken;
+	}
+
+	pthread_mutex_lock(&eventLock);
+	while(posted.empty()){
+		pthread_cond_wait(&eventReady, &eventLock);
+	}
+	taken = posted.front();
+	posted.pop_front();
+	pthread_mutex_unlock(&eventLock);
+	if(taken.expected)
+		outstanding--;
+	return taken;
+}
+
+bool EventQueue::empty(){
+	return outstanding == 0;
+}
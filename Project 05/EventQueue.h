@@ -0,0 +1,76 @@
+/**
+ * @file	EventQueue.h
+ * @brief	Definition file for EventQueue class
+ * @author	Wei Tong
+ * @details Specifies all members of EventQueue class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, collects finished operations
+ *			for the simulator. A virtual clock keeps them in
+ *			time order, a real clock has threads post them as
+ *			they happen
+ */
+
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include "SimClock.h"
+#include "Workload.h"
+#include <deque>
+#include <queue>
+#include <vector>
+#include <pthread.h>
+
+#define EV_CPU_DONE 1	// Processor or memory operation finished
+#define EV_IO_DONE 2	// I/O operation finished on a device
+#define EV_ARRIVAL 3	// New processes loaded while the simulation runs
+#define EV_GENERATED 4	// Virtual clock, the load generator's next process is due
+
+struct SimEvent{
+
+	long long time = 0;	// Simulated microseconds the event happened at
+	long long seq = 0;	// Order events with the same time were scheduled in
+	int type = 0;
+	int proc = -1;		// Index of the process the event belongs to
+	int core = -1;		// Core the operation ran on
+	int device = -1;	// Device type the I/O ran on
+	int unit = -1;		// Unit of that device type
+	long long token = 0;	// Slice the event finishes, stale once the slice is preempted
+	Workload* batch = NULL;	// Arrival, operations of the new processes
+	bool expected = true;	// False for wake ups posted with ring()
+};
+
+// Orders the virtual heap by time, then by scheduling order
+struct laterEvent{
+	bool operator()(const SimEvent &a, const SimEvent &b) const{
+		if(a.time != b.time)
+			return a.time > b.time;
+		return a.seq > b.seq;
+	}
+};
+
+class EventQueue{
+private:
+	SimClock* clock;
+	long long nextSeq;
+	int outstanding;	// Expected events that have not been taken
+
+	// Virtual clock
+	std::priority_queue<SimEvent, std::vector<SimEvent>, laterEvent> timeline;
+
+	// Real clock
+	std::deque<SimEvent> posted;
+	pthread_mutex_t eventLock;
+	pthread_cond_t eventReady;
+public:
+	EventQueue(SimClock*);					// Parameterized constructor
+	~EventQueue();							// Default deconstructor
+	void schedule(SimEvent, int);			// Virtual clock, event happens msec from now
+	void expect();							// Real clock, a thread will post one event
+	void post(SimEvent);					// Real clock, thread safe, stamps the time
+	void ring(SimEvent);					// Real clock, thread safe, posts a wake up nobody expected
+	SimEvent next();						// Takes the next event, waits or jumps the clock
+	bool empty();							// True when no event is still expected
+};
+
+#endif
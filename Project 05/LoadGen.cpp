@@ -0,0 +1,156 @@
+/**
+ * @file	LoadGen.cpp
+ * @brief	Implementation of LoadGen class
+ * @author	Wei Tong
+ * @details All members of LoadGen are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires LoadGen.h
+ */
+
+#include "LoadGen.h"
+#include <cmath>
+
+// Default constructor, makes nothing until setup
+LoadGen::LoadGen(){
+	shape = LOAD_POISSON;
+	rate = 0;
+	peak = 0;
+	burstOn = 0;
+	burstOff = 0;
+	period = 0;
+	swing = 0;
+	remaining = 0;
+	total = 0;
+	due = 0;
+	rng.seed(1);	// Same load every run
+}
+
+// Default deconstructor, nothing to deallocate
+LoadGen::~LoadGen(){
+
+}
+
+// Without a Load mix processes mostly run, with some memory and I/O
+void LoadGen::setup(ConfData &genConf){
+
+	total = remaining = genConf.get_load_procs();
+	if(total <= 0){
+		total = remaining = 0;
+		return;
+	}
+
+	rate = genConf.get_load_rate() / 1000.0;
+	peak = rate;
+	if(genConf.get_load_shape() == "Bursty"){
+		shape = LOAD_BURSTY;
+		burstOn = genConf.get_burst_on();
+		burstOff = genConf.get_burst_off();
+		peak = rate * (burstOn + burstOff) / burstOn;
+	}
+	else if(genConf.get_load_shape() == "Diurnal"){
+		shape = LOAD_DIURNAL;
+		period = genConf.get_diurnal_period();
+		swing = genConf.get_diurnal_swing() / 100.0;
+		peak = rate * (1 + swing);
+	}
+
+	std::vector<int> weights;
+	for(int i = 0; i < genConf.get_mixes(); i++){
+		mixDesc.push_back(MetaObj::encode(genConf.get_mix_desc(i)));
+		weights.push_back(genConf.get_mix_weight(i));
+	}
+	if(mixDesc.empty()){
+		metaDesc defaults[5] = {DESC_RUN, DESC_ALLOCATE, DESC_BLOCK, DESC_HARD_DRIVE, DESC_MONITOR};
+		int defaultWeights[5] = {6, 1, 1, 1, 1};
+		mixDesc.assign(defaults, defaults + 5);
+		weights.assign(defaultWeights, defaultWeights + 5);
+	}
+	pickOp = std::discrete_distribution<int>(weights.begin(), weights.end());
+
+	// Uniform around the configured means
+	numOps = std::uniform_int_distribution<int>(1, 2 * genConf.get_load_ops() - 1);
+	numCycles = std::uniform_int_distribution<int>(1, 2 * genConf.get_load_cycles() - 1);
+
+	draw();
+}
+
+double LoadGen::rateAt(double time){
+	if(shape == LOAD_BURSTY)
+		return fmod(time, burstOn + burstOff) < burstOn ? peak : 0;
+	if(shape == LOAD_DIURNAL)
+		return rate * (1 + swing * sin(2 * M_PI * time / period));
+	return rate;
+}
+
+void LoadGen::draw(){
+	std::exponential_distribution<double> gap(peak);
+	std::uniform_real_distribution<double> keep(0, peak);
+	do{
+		due += gap(rng);
+	}while(shape != LOAD_POISSON && keep(rng) >= rateAt(due));
+}
+
+bool LoadGen::more(){
+	return remaining > 0;
+}
+
+long long LoadGen::nextAt(){
+	return llround(due);
+}
+
+// One process, A{begin} and A{finish} around operations drawn from the
+// mix. Hard drive operations read or write at random
+Workload* LoadGen::generate(){
+
+	Workload* batch = new Workload;
+	batch->push(MetaObj('A', DESC_BEGIN, 0));
+	int ops = numOps(rng);
+	for(int i = 0; i < ops; i++){
+		metaDesc desc = mixDesc[pickOp(rng)];
+		char code;
+		switch(desc){
+		case DESC_RUN:
+			code = 'P';
+			break;
+		case DESC_ALLOCATE:
+		case DESC_BLOCK:
+			code = 'M';
+			break;
+		case DESC_KEYBOARD:
+		case DESC_SCANNER:
+			code = 'I';
+			break;
+		case DESC_MONITOR:
+		case DESC_PROJECTOR:
+			code = 'O';
+			break;
+		default:
+			code = (rng() & 1) ? 'I' : 'O';
+		}
+		batch->push(MetaObj(code, desc, numCycles(rng)));
+	}
+	batch->push(MetaObj('A', DESC_FINISH, 0));
+
+	remaining--;
+	if(remaining > 0)
+		draw();
+	return batch;
+}
+
+int LoadGen::getTotal(){
+	return total;
+}
+
+double LoadGen::getRate(){
+	return rate * 1000;
+}
+
+std::string LoadGen::getShape(){
+	if(shape == LOAD_BURSTY)
+		return "Bursty";
+	if(shape == LOAD_DIURNAL)
+		return "Diurnal";
+	return "Poisson";
+}
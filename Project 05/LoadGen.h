@@ -0,0 +1,63 @@
+/**
+ * @file	LoadGen.h
+ * @brief	Definition file for LoadGen class
+ * @author	Wei Tong
+ * @details Specifies all members of LoadGen class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, makes up processes while the
+ *			simulation runs instead of loading them from a file
+ */
+
+#ifndef LOADGEN_H
+#define LOADGEN_H
+
+#include "ConfData.h"
+#include "Workload.h"
+#include <random>
+#include <string>
+#include <vector>
+
+#define LOAD_POISSON 1	// Exponential gaps at a steady rate
+#define LOAD_BURSTY 2	// Steady rate while on, nothing while off
+#define LOAD_DIURNAL 3	// Rate rises and falls along a sine curve
+
+// Open loop load, arrivals do not wait on the simulator. Every shape
+// has the configured mean rate. Bursty and Diurnal draw candidates at
+// their peak rate and keep each with the share the current rate is of
+// the peak, so the gaps stay exponential within the curve
+class LoadGen{
+private:
+	int shape;
+	double rate;			// Mean arrivals per msec
+	double peak;			// Highest arrivals per msec the shape reaches
+	int burstOn;			// Msec, Bursty only
+	int burstOff;
+	int period;				// Msec, Diurnal only
+	double swing;			// Fraction of the mean, Diurnal only
+	int remaining;			// Processes still to make
+	int total;
+	double due;				// Msec after the start the next process arrives at
+	std::mt19937 rng;
+
+	// Operation mix
+	std::vector<metaDesc> mixDesc;
+	std::discrete_distribution<int> pickOp;
+	std::uniform_int_distribution<int> numOps;
+	std::uniform_int_distribution<int> numCycles;
+
+	double rateAt(double);					// Arrivals per msec at a time
+	void draw();							// Moves due on to the next arrival
+public:
+	LoadGen();								// Default constructor, makes nothing
+	~LoadGen();								// Default deconstructor
+	void setup(ConfData &);					// Reads the load generator config
+	bool more();							// True while processes are still to come
+	long long nextAt();						// Msec after the start the next process arrives at
+	Workload* generate();					// Operations of the next process, then draws the one after
+	int getTotal();							// Processes made over the whole run
+	double getRate();						// Mean arrivals per second
+	std::string getShape();					// Name of the arrival shape
+};
+
+#endif
@@ -0,0 +1,355 @@
+/**
+ * @file	MdfReader.cpp
+ * @brief	Implementation of MdfReader class
+ * @author	Wei Tong
+ * @details All members of MdfReader are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires MdfReader.h
+ */
+
+#include "MdfReader.h"
+#include <algorithm>
+#include <charconv>
+#include <cctype>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Default constructor, nothing mapped
+MdfReader::MdfReader(){
+	fd = -1;
+	data = NULL;
+	length = 0;
+	released = 0;
+	lineCounter = 0;
+}
+
+// Deconstructor, releases the mapping
+MdfReader::~MdfReader(){
+	if(data)
+		munmap((void*)data, length);
+	if(fd >= 0)
+		close(fd);
+}
+
+// A file that opens but cannot be mapped has no first line to read,
+// the same as an empty one
+int MdfReader::open(std::string fileName){
+
+	fd = ::open(fileName.c_str(), O_RDONLY);
+	if(fd < 0)
+		return 5;
+
+	struct stat info;
+	if(fstat(fd, &info) || info.st_size == 0)
+		return 6;
+	length = info.st_size;
+
+	void* mapped = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+	if(mapped == MAP_FAILED){
+		length = 0;
+		return 6;
+	}
+	madvise(mapped, length, MADV_SEQUENTIAL);
+	data = (const char*)mapped;
+	return 0;
+}
+
+// Only blanks and tabs, as isblank in the C locale
+static inline bool blank(char c){
+	return c == ' ' || c == '\t';
+}
+
+// Pages are only handed back this many bytes at a time
+#define RELEASE_STEP (16 << 20)
+
+// Below this many bytes a file is parsed on one thread
+#define PARALLEL_MIN (4 << 20)
+
+// Each parsing thread gets at least this many bytes
+#define CHUNK_MIN (1 << 20)
+
+#define END_LINE "End Program Meta-Data Code."
+
+// Splits text the way getline did. A last line without a newline
+// still counts, a newline at the very end does not start another
+static bool splitLine(std::string_view &text, std::string_view &line){
+	if(text.empty())
+		return false;
+	std::size_t end = text.find('\n');
+	if(end == std::string_view::npos){
+		line = text;
+		text = std::string_view();
+	}
+	else{
+		line = text.substr(0, end);
+		text.remove_prefix(end + 1);
+	}
+	return true;
+}
+
+bool MdfReader::nextLine(std::string_view &line){
+	if(!splitLine(rest, line))
+		return false;
+
+	// Nothing points into the lines before this one any more
+	std::size_t parsed = line.data() - data;
+	if(parsed - released >= RELEASE_STEP){
+		std::size_t page = sysconf(_SC_PAGESIZE);
+		std::size_t upTo = parsed / page * page;
+		madvise((void*)(data + released), upTo - released, MADV_DONTNEED);
+		released = upTo;
+	}
+	return true;
+}
+
+int MdfReader::start(){
+
+	rest = std::string_view(data, length);
+	released = 0;
+	lineCounter = 0;
+
+	std::string_view first;
+	if(!nextLine(first))
+		return 6;
+
+	if(first != "Start Program Meta-Data Code:")
+		return 7;
+
+	lineCounter = 1;
+	return 0;
+}
+
+// The count moves on past the end line too, so after an error it is
+// the line that failed
+int MdfReader::next(Workload &inQ){
+
+	std::string_view text;
+	int readStatus;
+	if(!nextLine(text) || text == END_LINE){
+		rest = std::string_view();
+		readStatus = 4;	// Done reading
+	}
+	else
+		readStatus = parseLine(text, inQ);
+	lineCounter++;
+	return readStatus;
+}
+
+int MdfReader::line(){
+	return lineCounter;
+}
+
+// Returns 0 when done, the parseLine error with lineCounter at the bad
+// line, 6 if nothing is mapped or 7 if the file starts wrong. A large
+// file is parsed on every processor
+int MdfReader::load(Workload &inQ, int &lines){
+
+	int readStatus = start();
+	if(!readStatus){
+		long processors = sysconf(_SC_NPROCESSORS_ONLN);
+		long chunks = rest.size() / CHUNK_MIN;
+		if(chunks > processors)
+			chunks = processors;
+		if(rest.size() >= PARALLEL_MIN && chunks > 1)
+			readStatus = loadChunks(inQ, chunks);
+		else{
+			while(!readStatus){
+				readStatus = next(inQ);
+			}
+		}
+	}
+	lines = lineCounter;
+
+	if(readStatus == 4)
+		return 0;
+	return readStatus;
+}
+
+// Parses its lines until the end line or the first bad one
+void* MdfReader::parseChunk(void* casted_chunk){
+
+	mdfChunk* chunk = (mdfChunk*)casted_chunk;
+	MdfReader local;	// Only for its own fallback buffer
+	std::string_view line;
+	while(splitLine(chunk->text, line)){
+		chunk->lines++;
+		if(line == END_LINE){
+			chunk->ended = true;
+			break;
+		}
+		chunk->status = local.parseLine(line, chunk->ops);
+		if(chunk->status)
+			break;
+	}
+	return casted_chunk;
+}
+
+// The rest of the file is cut into ranges of whole lines, each parsed
+// on a thread of its own into a workload of its own. The workloads are
+// joined in file order, and the first chunk to stop at the end line or
+// a bad line stops the load. Line numbers add up the lines of the
+// chunks before it, so an error names the same line a single pass would
+int MdfReader::loadChunks(Workload &inQ, int chunks){
+
+	std::vector<mdfChunk> parts(chunks);
+	std::size_t from = 0;
+	for(int i = 0; i < chunks; i++){
+		std::size_t to = rest.size() * (i + 1) / chunks;
+		if(i == chunks - 1)
+			to = rest.size();
+		else{
+			std::size_t newline = rest.find('\n', to < from ? from : to);
+			to = newline == std::string_view::npos ? rest.size() : newline + 1;
+		}
+		parts[i].text = rest.substr(from, to - from);
+		from = to;
+	}
+
+	for(int i = 1; i < chunks; i++){
+		pthread_create(&parts[i].thread, NULL, parseChunk, (void *) &parts[i]);
+	}
+	parseChunk(&parts[0]);
+	for(int i = 1; i < chunks; i++){
+		pthread_join(parts[i].thread, NULL);
+	}
+	rest = std::string_view();
+
+	std::size_t total = inQ.ops.size();
+	for(int i = 0; i < chunks; i++){
+		total += parts[i].ops.ops.size();
+	}
+	inQ.ops.reserve(total);
+
+	for(int i = 0; i < chunks; i++){
+		inQ.extend(parts[i].ops);
+		lineCounter += parts[i].lines;
+		if(parts[i].status)
+			return parts[i].status;
+		if(parts[i].ended)
+			return 4;
+	}
+	lineCounter++;	// Ran out of lines, a single pass counts that too
+	return 4;
+}
+
+// Skips white space and takes a leading + as operator>> does, the rest
+// is from_chars. Overflow fails as it does for a stream
+bool MdfReader::readCycles(std::string_view text, int &cycles){
+
+	std::size_t at = 0;
+	while(at < text.size() && isspace((unsigned char)text[at]))
+		at++;
+	if(at < text.size() && text[at] == '+'){
+		at++;
+		if(at == text.size() || !isdigit((unsigned char)text[at]))
+			return false;
+	}
+	std::from_chars_result result = std::from_chars(text.data() + at, text.data() + text.size(), cycles);
+	return result.ec == std::errc();
+}
+
+// Checks are in the original order: the cycles must read as a number
+// before the code, then the description, then the cycle range are tried
+static int addOperation(char code, std::string_view description, bool readOk, int cycles, Workload &inQ){
+
+	if(!readOk)
+		return 3;
+	MetaObj newMD;
+	if(!newMD.setCode(code))
+		return 1;
+	if(!newMD.setDescription(description))
+		return 2;
+	if(!newMD.setCycles(cycles))
+		return 3;
+	inQ.push(newMD);
+	return 0;
+}
+
+// Blanks never reach the original parse, so they are skipped here and
+// dropped from the description. A token takes the fast path when its
+// code is followed by {, the } comes before any ; or . and the cycles
+// have no blank inside them
+int MdfReader::parseLine(std::string_view line, Workload &inQ){
+
+	std::size_t at = 0;
+	while(true){
+		while(at < line.size() && blank(line[at]))
+			at++;
+		if(at == line.size())
+			return 0;
+
+		char code = line[at];
+		std::size_t open = at + 1;
+		while(open < line.size() && blank(line[open]))
+			open++;
+		if(code == '{' || code == '}' || code == ';' || code == '.' || open == line.size() || line[open] != '{')
+			break;
+
+		std::size_t close = line.find_first_of("};.", open + 1);
+		if(close == std::string_view::npos || line[close] != '}')
+			break;
+		std::size_t end = line.find_first_of(";.", close + 1);
+		if(end == std::string_view::npos)
+			break;
+		std::string_view number = line.substr(close + 1, end - close - 1);
+		if(number.find_first_of(" \t") != std::string_view::npos)
+			break;
+
+		// Longest description is nine letters, anything that does not
+		// fit is not one of them
+		char name[16];
+		std::size_t nameLength = 0;
+		for(std::size_t i = open + 1; i < close; i++){
+			if(blank(line[i]))
+				continue;
+			if(nameLength == sizeof(name)){
+				nameLength = 0;
+				break;
+			}
+			name[nameLength++] = line[i];
+		}
+
+		int cycles = 0;
+		bool readOk = readCycles(number, cycles);
+		int status = addOperation(code, std::string_view(name, nameLength), readOk, cycles, inQ);
+		if(status)
+			return status;
+		at = end + 1;
+	}
+
+	stripped.assign(line.data() + at, line.size() - at);
+	stripped.erase(std::remove_if(stripped.begin(), stripped.end(), blank), stripped.end());
+	return parseStripped(stripped, inQ);
+}
+
+// The original parse, kept index for index so odd lines fail the same
+// way. A last token without ; or . ends the line instead of being read
+// again forever
+int MdfReader::parseStripped(std::string_view inputStr, Workload &inQ){
+
+	while(!inputStr.empty()){
+
+		char code = inputStr[0];
+		std::size_t open = inputStr.find_first_of("{");
+		std::size_t close = inputStr.find_first_of("}");
+		std::size_t end = inputStr.find_first_of(";.");
+		std::string_view description = inputStr.substr(open + 1, close - 2);
+		std::string_view number = inputStr.substr(close + 1, end - close);
+
+		int cycles = 0;
+		bool readOk = readCycles(number, cycles);
+		int status = addOperation(code, description, readOk, cycles, inQ);
+		if(status)
+			return status;
+
+		if(end == std::string_view::npos)
+			return 0;
+		inputStr = inputStr.substr(end + 1);
+	}
+	return 0;
+}
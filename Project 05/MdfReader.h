@@ -0,0 +1,73 @@
+/**
+ * @file	MdfReader.h
+ * @brief	Definition file for MdfReader class
+ * @author	Wei Tong
+ * @details Specifies all members of MdfReader class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, parses meta data files in place
+ *			instead of copying every line and token
+ */
+
+#ifndef MDFREADER_H
+#define MDFREADER_H
+
+#include "Workload.h"
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <pthread.h>
+
+// One range of lines parsed on a thread of its own
+struct mdfChunk{
+
+	std::string_view text;		// Whole lines, the last one may have no newline
+	Workload ops;				// Operations parsed, spans as if the file started here
+	int lines = 0;				// Lines read, the end line or bad line included
+	int status = 0;				// Error code of the bad line, 0 if none
+	bool ended = false;			// Stopped at the end line
+	pthread_t thread;
+};
+
+// Maps a meta data file read only and parses it where it lies. Tokens
+// are views into the mapping, cycles are read with from_chars, so a
+// well formed line is scanned once and nothing is allocated for it.
+//
+// A large file is loaded on several threads, each parsing a range of
+// whole lines. The file can also be read a line at a time with start
+// and next.
+// Pages are handed back to the kernel once they have been parsed, so
+// a file larger than memory only ever has a small part of it loaded
+//
+// Anything that does not look like C{description}N; or . falls back to
+// the original parse on a copy of the rest of the line with blanks
+// removed, so malformed lines give the same error as they always did
+class MdfReader{
+private:
+	int fd;
+	const char* data;
+	std::size_t length;
+	std::string stripped;		// Reused by the fallback, grows to the longest bad line
+	std::string_view rest;		// Part of the mapping still to be read
+	std::size_t released;		// Bytes from the start already handed back
+	int lineCounter;			// Lines read so far, the bad one after an error
+
+	int parseStripped(std::string_view, Workload &);
+	bool nextLine(std::string_view &);
+	int loadChunks(Workload &, int);
+	static void* parseChunk(void*);
+public:
+	MdfReader();								// Default constructor, no file
+	~MdfReader();								// Unmaps and closes the file
+	MdfReader(const MdfReader &) = delete;
+	MdfReader &operator=(const MdfReader &) = delete;
+	int open(std::string);						// 0 when mapped, 5 if missing or 6 if empty
+	int load(Workload &, int &);				// Parses the mapped file, mdfLoad's return codes
+	int start();								// Checks the first line, 0, 6 if empty or 7 if it starts wrong
+	int next(Workload &);						// Parses one more line, 0, 4 at the end or the error code
+	int line();									// Lines read so far
+	int parseLine(std::string_view, Workload &);	// One line of operations, 0 or the error code
+	static bool readCycles(std::string_view, int &);	// Integer as a stream would extract it
+};
+
+#endif
@@ -0,0 +1,150 @@
+/**
+ * @file	MdfStream.cpp
+ * @brief	Implementation of MdfStream class
+ * @author	Wei Tong
+ * @details All members of MdfStream are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires MdfStream.h
+ */
+
+#include "MdfStream.h"
+#include <vector>
+
+// Default constructor, nothing to read yet
+MdfStream::MdfStream(){
+	capacity = 1;
+	running = false;
+	done = false;
+	stopping = false;
+	status = 0;
+	errorLine = 0;
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&notEmpty, NULL);
+	pthread_cond_init(&notFull, NULL);
+}
+
+// The reader thread may be waiting on a full buffer
+MdfStream::~MdfStream(){
+	if(running){
+		pthread_mutex_lock(&lock);
+		stopping = true;
+		pthread_cond_broadcast(&notFull);
+		pthread_mutex_unlock(&lock);
+		pthread_join(thread, NULL);
+	}
+	for(unsigned int i = 0; i < buffer.size(); i++){
+		delete buffer[i];
+	}
+	pthread_cond_destroy(&notFull);
+	pthread_cond_destroy(&notEmpty);
+	pthread_mutex_destroy(&lock);
+}
+
+int MdfStream::open(std::string fileName, int window){
+
+	capacity = window > 0 ? window : 1;
+	int readStatus = reader.open(fileName);
+	if(readStatus)
+		return readStatus;
+	return reader.start();
+}
+
+void MdfStream::start(){
+	running = true;
+	pthread_create(&thread, NULL, produce, (void *) this);
+}
+
+// A line can end part way through a process, that process stays in
+// the staging workload until a later line finishes it
+void* MdfStream::produce(void* casted_stream){
+
+	MdfStream* self = (MdfStream*)casted_stream;
+	Workload staging;
+	std::vector<Workload*> finished;
+
+	int readStatus = 0;
+	while(!readStatus){
+		readStatus = self->reader.next(staging);
+		if(readStatus != 0 && readStatus != 4)
+			break;
+
+		staging.split(finished, readStatus == 4);
+		for(unsigned int i = 0; i < finished.size(); i++){
+			if(!self->put(finished[i])){
+				for(; i < finished.size(); i++){
+					delete finished[i];
+				}
+				return casted_stream;
+			}
+		}
+		finished.clear();
+	}
+
+	pthread_mutex_lock(&self->lock);
+	if(readStatus != 4){
+		self->status = readStatus;
+		self->errorLine = self->reader.line();
+	}
+	self->done = true;
+	pthread_cond_broadcast(&self->notEmpty);
+	pthread_mutex_unlock(&self->lock);
+	return casted_stream;
+}
+
+bool MdfStream::put(Workload* proc){
+
+	pthread_mutex_lock(&lock);
+	while(buffer.size() >= capacity && !stopping){
+		pthread_cond_wait(&notFull, &lock);
+	}
+	if(stopping){
+		pthread_mutex_unlock(&lock);
+		return false;
+	}
+	buffer.push_back(proc);
+	pthread_cond_signal(&notEmpty);
+	pthread_mutex_unlock(&lock);
+	return true;
+}
+
+// Processes are moved in after the lock is let go, so the reader
+// thread can carry on parsing while they are copied
+int MdfStream::take(Workload &batch, int count){
+
+	std::vector<Workload*> taken;
+	pthread_mutex_lock(&lock);
+	while((int)taken.size() < count){
+		while(buffer.empty() && !done){
+			pthread_cond_wait(&notEmpty, &lock);
+		}
+		if(buffer.empty())
+			break;
+		taken.push_back(buffer.front());
+		buffer.pop_front();
+		pthread_cond_signal(&notFull);
+	}
+	pthread_mutex_unlock(&lock);
+
+	for(unsigned int i = 0; i < taken.size(); i++){
+		batch.absorb(*taken[i]);
+		delete taken[i];
+	}
+	return taken.size();
+}
+
+bool MdfStream::more(){
+	pthread_mutex_lock(&lock);
+	bool left = !done || !buffer.empty();
+	pthread_mutex_unlock(&lock);
+	return left;
+}
+
+int MdfStream::error(int &line){
+	pthread_mutex_lock(&lock);
+	int readStatus = status;
+	line = errorLine;
+	pthread_mutex_unlock(&lock);
+	return readStatus;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file	MdfStream.h
+ * @brief	Definition file for MdfStream class
+ * @author	Wei Tong
+ * @details Specifies all members of MdfStream class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, feeds the simulator from a meta
+ *			data file while it runs instead of loading it first
+ */
+
+#ifndef MDFSTREAM_H
+#define MDFSTREAM_H
+
+#include "MdfReader.h"
+#include "Workload.h"
+#include <deque>
+#include <string>
+#include <pthread.h>
+
+// A reader thread parses the meta data file into a buffer of at most
+// capacity processes, one workload each, and waits while it is full.
+// The simulator takes processes out as it has room for them, so only
+// the buffer and the processes being simulated are ever in memory
+class MdfStream{
+private:
+	MdfReader reader;
+	std::deque<Workload*> buffer;	// Parsed processes in file order
+	unsigned int capacity;
+	bool running;					// The reader thread was started
+	bool done;						// The reader thread has read its last line
+	bool stopping;					// The simulator is done, the reader thread should quit
+	int status;						// 0, or the error code of the bad line
+	int errorLine;
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t notEmpty;
+	pthread_cond_t notFull;
+
+	static void* produce(void*);	// Reader thread
+	bool put(Workload*);			// Reader thread, false once stopping
+public:
+	MdfStream();							// Default constructor, no file
+	~MdfStream();							// Stops the reader thread, deletes what was not taken
+	MdfStream(const MdfStream &) = delete;
+	MdfStream &operator=(const MdfStream &) = delete;
+	int open(std::string, int);				// Maps the file and checks its start, mdfLoad's codes 5 to 7
+	void start();							// Starts the reader thread
+	int take(Workload &, int);				// Moves up to that many processes in, waits for them, returns how many
+	bool more();							// True until the file is read and the buffer empty
+	int error(int &);						// Error code of the bad line and its number, 0 if none
+};
+
+#endif
@@ -11,21 +11,29 @@
 
 #include "MetaObj.h"
 
+// v6.0, name of each description, indexed by metaDesc
+static const std::string_view descNames[DESC_COUNT] = {
+	"", "begin", "finish", "hard drive", "keyboard", "scanner", "monitor", "run",
+	"allocate", "projector", "block", "nice", "tickets", "deadline", "period",
+	"priority", "arrival"
+};
+
 // Default constructor, sets initial values
 MetaObj::MetaObj(){
 	metaCode = ' ';
-	metaDescription = "";
+	metaDescription = DESC_NONE;
 	metaCycles = -1;
 }
 
-// Deconstructor, nothing here yet
-MetaObj::~MetaObj(){
-
-}
-
 // Parameterized constructor, sets specified values
 // Should NEVER be used, unless input is guaranteed correct
 MetaObj::MetaObj(char inptCode, std::string inptDescription, int inptCycles){
+	metaCode = inptCode;
+	metaDescription = encode(inptDescription);
+	metaCycles = inptCycles;
+}
+
+MetaObj::MetaObj(char inptCode, metaDesc inptDescription, int inptCycles){
 	metaCode = inptCode;
 	metaDescription = inptDescription;
 	metaCycles = inptCycles;
@@ -48,33 +56,61 @@ char MetaObj::getCode(){
 }
 
 // Don't really need, but just in case
-bool MetaObj::setDescription(std::string inptDescription){
-	if(!inptDescription.compare("begin") || !inptDescription.compare("finish") || !inptDescription.compare("harddrive") ||
-		!inptDescription.compare("keyboard") || !inptDescription.compare("scanner") || !inptDescription.compare("monitor") ||
-		!inptDescription.compare("run") || !inptDescription.compare("allocate") || !inptDescription.compare("projector") || 
-		!inptDescription.compare("block")){
-
-		// v2.0 changed description from "hard drive" to "harddrive" to work with new implementation
-		if(!inptDescription.compare("harddrive")){
-			metaDescription = "hard drive";
-		}
-		else{
-			metaDescription = inptDescription;
-		}
-		return true;
-	}
-	else{
+// v2.0 changed description from "hard drive" to "harddrive" to work with new implementation
+// v6.0, the code is set first. Begin and finish belong to S and A,
+// process attributes only to A
+bool MetaObj::setDescription(std::string_view inptDescription){
+	if(inptDescription == "hard drive")
+		return false;	// The parser strips the blank, only "harddrive" is meta data
+	metaDesc inptDesc = encode(inptDescription);
+	if(inptDesc == DESC_NONE)
 		return false;
-	}
+	if(inptDesc >= DESC_NICE && metaCode != 'A')
+		return false;
+	if((inptDesc == DESC_BEGIN || inptDesc == DESC_FINISH) && metaCode != 'A' && metaCode != 'S')
+		return false;
+	metaDescription = inptDesc;
+	return true;
 }
 
 // Function to get meta-data description
 std::string MetaObj::getDescription(){
+	return std::string(descNames[metaDescription]);
+}
+
+metaDesc MetaObj::getDesc(){
 	return metaDescription;
 }
 
+// Every A operation other than begin and finish
+bool MetaObj::isAttribute(){
+	return metaCode == 'A' && metaDescription >= DESC_NICE;
+}
+
+// Accepts both spellings of hard drive
+metaDesc MetaObj::encode(std::string_view name){
+	if(name == "harddrive")
+		return DESC_HARD_DRIVE;
+	for(int desc = DESC_BEGIN; desc < DESC_COUNT; desc++){
+		if(name == descNames[desc])
+			return (metaDesc)desc;
+	}
+	return DESC_NONE;
+}
+
 // Don't really need, but just in case
+// v6.0, A{nice}, A{tickets}, A{deadline}, A{period}, A{priority} and
+// A{arrival} are process attributes, not cycle counts. Nice runs from
+// -20 to 19, priority and arrival from 0 up and the others from 1 up
 bool MetaObj::setCycles(int inptCycles){
+	if(metaDescription == DESC_NICE){
+		if(inptCycles < -20 || inptCycles > 19)
+			return false;
+		metaCycles = inptCycles;
+		return true;
+	}
+	if((metaDescription == DESC_TICKETS || metaDescription == DESC_DEADLINE || metaDescription == DESC_PERIOD) && inptCycles < 1)
+		return false;
 	if(inptCycles >= 0){
 		metaCycles = inptCycles;
 		return true;
@@ -9,21 +9,58 @@
  *			be used in the future
  */
 
+#ifndef METAOBJ_H
+#define METAOBJ_H
+
 #include <string>
+#include <string_view>
+
+// v6.0, descriptions are stored as one of these, the names are only
+// used when the meta data is parsed and when the log is written
+enum metaDesc : unsigned char{
+	DESC_NONE,
+	DESC_BEGIN,
+	DESC_FINISH,
+	DESC_HARD_DRIVE,
+	DESC_KEYBOARD,
+	DESC_SCANNER,
+	DESC_MONITOR,
+	DESC_RUN,
+	DESC_ALLOCATE,
+	DESC_PROJECTOR,
+	DESC_BLOCK,
+	DESC_NICE,			// Process attributes from here on
+	DESC_TICKETS,
+	DESC_DEADLINE,
+	DESC_PERIOD,
+	DESC_PRIORITY,
+	DESC_ARRIVAL,
+	DESC_COUNT
+};
 
+// v6.0, code, description and cycles packed in 8 bytes, so the class
+// is trivially copyable and a workload is a plain array
 class MetaObj{
 private:
 	char metaCode;
-	std::string metaDescription;
+	metaDesc metaDescription;
 	int metaCycles;
 public:
 	MetaObj();																// Default constructor
-	~MetaObj();																// Default deconstructor
+	~MetaObj() = default;													// Default deconstructor
 	MetaObj(char inputCode, std::string inputDescription, int inputCycles);	// Parameterized constructor
+	MetaObj(char inputCode, metaDesc inputDescription, int inputCycles);	// Same, description already encoded
+	MetaObj(const MetaObj &) = default;										// Copy constructor
+	MetaObj &operator=(const MetaObj &) = default;							// Copy assignment
 	bool setCode(char);														// Sets the code for the meta-data
 	char getCode();															// Retrieves the code for the meta-data
-	bool setDescription(std::string);										// Sets the description for the meta-data
+	bool setDescription(std::string_view);									// Sets the description for the meta-data
 	std::string getDescription();											// Retrieves the description for the meta-data
+	metaDesc getDesc();														// Retrieves the encoded description
+	bool isAttribute();														// True for A operations that set up a process
 	bool setCycles(int);													// Sets the number of cycles
 	int getCycles();														// Retrieves the number of cycles
-};
\ No newline at end of file
+	static metaDesc encode(std::string_view);								// Description for a name, DESC_NONE if unknown
+};
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * @file	MlfqPolicy.cpp
+ * @brief	Implementation of MlfqPolicy class
+ * @author	Wei Tong
+ * @details All members of MlfqPolicy are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires MlfqPolicy.h
+ */
+
+#include "MlfqPolicy.h"
+#include <climits>
+
+void MlfqPolicy::setup(simState &sim, ConfData &schConf){
+	numLevels = schConf.get_mlfq_levels();
+	baseQuantum = schConf.get_pqn();
+	boostPeriod = (long long)schConf.get_mlfq_boost() * 1000;
+	nextBoost = boostPeriod;
+	levels.assign(sim.cores.size(), std::vector<std::deque<int>>(numLevels));
+	count.assign(sim.cores.size(), 0);
+	boosts = 0;
+	demotions = 0;
+}
+
+// Processor time a process gets on a level before it drops, a large
+// quantum on a low level stops at the longest an int can hold
+int MlfqPolicy::allotment(int inptLevel){
+	long long slice = (long long)baseQuantum << inptLevel;
+	return slice < INT_MAX ? slice : INT_MAX;
+}
+
+// Moves every process back to level 0 once the boost period has gone
+// by. Checked whenever the policy makes a decision, so the boost lands
+// on the first decision after it is due
+void MlfqPolicy::boost(simState &sim){
+
+	if(boostPeriod <= 0 || sim.clock->now() < nextBoost)
+		return;
+	while(nextBoost <= sim.clock->now()){
+		nextBoost += boostPeriod;
+	}
+
+	// Queued processes keep their order, higher levels first
+	for(unsigned int core = 0; core < levels.size(); core++){
+		for(int i = 1; i < numLevels; i++){
+			while(!levels[core][i].empty()){
+				levels[core][0].push_back(levels[core][i].front());
+				levels[core][i].pop_front();
+			}
+		}
+	}
+	level.assign(level.size(), 0);
+	used.assign(used.size(), 0);
+	boosts++;
+}
+
+int MlfqPolicy::levelOf(int proc){
+	return level[proc];
+}
+
+void MlfqPolicy::onArrival(simState &sim, int proc){
+	level.resize(sim.procs.size(), 0);
+	used.resize(sim.procs.size(), 0);
+}
+
+void MlfqPolicy::enqueue(simState &sim, int core, int proc){
+	boost(sim);
+	levels[core][levelOf(proc)].push_back(proc);
+	count[core]++;
+}
+
+int MlfqPolicy::pickNext(simState &sim, int core){
+
+	boost(sim);
+	for(int i = 0; i < numLevels; i++){
+		if(!levels[core][i].empty()){
+			int proc = levels[core][i].front();
+			levels[core][i].pop_front();
+			count[core]--;
+			return proc;
+		}
+	}
+	return -1;
+}
+
+int MlfqPolicy::waiting(int core){
+	return count[core];
+}
+
+// Takes the least urgent process, from the back of the lowest level
+int MlfqPolicy::steal(simState &sim, int core){
+
+	for(int i = numLevels - 1; i >= 0; i--){
+		if(!levels[core][i].empty()){
+			int proc = levels[core][i].back();
+			levels[core][i].pop_back();
+			count[core]--;
+			return proc;
+		}
+	}
+	return -1;
+}
+
+// What is left of the allotment on the process's level, without a
+// processor quantum MLFQ runs processing actions to the end
+int MlfqPolicy::quantum(simState &sim, int proc){
+
+	if(baseQuantum <= 0)
+		return 0;
+	int left = allotment(levelOf(proc)) - used[proc];
+	return left > 0 ? left : 1;
+}
+
+void MlfqPolicy::charge(simState &sim, int proc, int msec){
+
+	if(baseQuantum <= 0)
+		return;
+	used[proc] += msec;
+	if(level[proc] < numLevels - 1 && used[proc] >= allotment(level[proc])){
+		level[proc]++;
+		used[proc] = 0;
+		demotions++;
+	}
+}
+
+// A process takes over the core running the lowest level processing
+// action, if the process is on a higher level
+int MlfqPolicy::preemptTarget(simState &sim, int proc){
+
+	boost(sim);
+	int victim = -1;
+	int lowest = -1;
+	for(unsigned int core = 0; core < sim.cores.size(); core++){
+		int running = sim.cores[core].running;
+
+		// An idle core will pick the process up anyway
+		if(running == -1)
+			return -1;
+
+		// Only processing actions can be interrupted
+		if(currentOp(sim, running).getCode() != 'P')
+			continue;
+		if(levelOf(running) > lowest){
+			lowest = levelOf(running);
+			victim = core;
+		}
+	}
+	if(victim == -1 || levelOf(proc) >= lowest)
+		return -1;
+	return victim;
+}
+
+void MlfqPolicy::report(simState &sim){
+
+	std::string line = "MLFQ: " + std::to_string(numLevels) + " levels, " + std::to_string(demotions)
+		+ " demotions, " + std::to_string(boosts) + " boosts";
+	*sim.out1 << line << std::endl;
+	*sim.out2 << line << std::endl;
+}
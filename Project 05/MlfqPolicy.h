@@ -0,0 +1,56 @@
+/**
+ * @file	MlfqPolicy.h
+ * @brief	Definition file for MlfqPolicy class
+ * @author	Wei Tong
+ * @details Specifies all members of MlfqPolicy class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, Multi-Level Feedback Queue
+ */
+
+#ifndef MLFQPOLICY_H
+#define MLFQPOLICY_H
+
+#include "SchPolicy.h"
+#include <deque>
+#include <vector>
+
+// Multi-Level Feedback Queue. Processes start on level 0 and drop a
+// level each time they use up that level's allotment of processor time,
+// the quantum doubling on every level down. Processes that give up the
+// processor for I/O early keep their level. Every boost period all
+// processes go back to level 0 so long jobs are not starved
+class MlfqPolicy : public SchPolicy{
+private:
+	int numLevels;
+	int baseQuantum;			// Allotment of level 0 in msec, the processor quantum
+	long long boostPeriod;		// Simulated microseconds between boosts, 0 for none
+	long long nextBoost;
+	std::vector<std::vector<std::deque<int>>> levels;	// Ready queues of each core, by level
+	std::vector<int> count;		// Ready processes on each core
+	std::vector<int> level;		// Level of each process
+	std::vector<int> used;		// Msec each process has run on its level
+
+	// Statistics
+	long long boosts;
+	long long demotions;
+
+	int allotment(int);
+	void boost(simState &);
+	int levelOf(int);
+public:
+	static const bool PREEMPTIVE = true;
+	static const bool STREAMS = false;
+	void setup(simState &, ConfData &);
+	void onArrival(simState &, int);
+	void enqueue(simState &, int, int);
+	int pickNext(simState &, int);
+	int waiting(int);
+	int steal(simState &, int);
+	int quantum(simState &, int);
+	void charge(simState &, int, int);
+	int preemptTarget(simState &, int);
+	void report(simState &);
+};
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @file	PriorityPolicy.cpp
+ * @brief	Implementation of PriorityPolicy class
+ * @author	Wei Tong
+ * @details All members of PriorityPolicy are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires PriorityPolicy.h
+ */
+
+#include "PriorityPolicy.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+void PriorityPolicy::setup(simState &sim, ConfData &schConf){
+	agingPeriod = (long long)schConf.get_ps_aging() * 1000;
+	order = 0;
+	heap.assign(sim.cores.size(), std::priority_queue<readyEntry>());
+}
+
+void PriorityPolicy::onArrival(simState &sim, int proc){
+	readySince.resize(sim.procs.size(), 0);
+}
+
+void PriorityPolicy::enqueue(simState &sim, int core, int proc){
+
+	readySince[proc] = sim.clock->now();
+	long long key = sim.procs[proc].priority;
+	if(agingPeriod > 0)
+		key = key * agingPeriod - readySince[proc];
+	heap[core].push(std::make_pair(std::make_pair(key, -order), proc));
+	order++;
+}
+
+// Takes the top of the heap and records how long it waited
+int PriorityPolicy::take(simState &sim, int core){
+
+	int proc = heap[core].top().second;
+	heap[core].pop();
+	waits[sim.procs[proc].priority].push_back(sim.clock->now() - readySince[proc]);
+	return proc;
+}
+
+int PriorityPolicy::pickNext(simState &sim, int core){
+
+	if(heap[core].empty())
+		return -1;
+	return take(sim, core);
+}
+
+int PriorityPolicy::waiting(int core){
+	return heap[core].size();
+}
+
+// The heap only gives up its top, so that is what is stolen
+int PriorityPolicy::steal(simState &sim, int core){
+
+	if(heap[core].empty())
+		return -1;
+	return take(sim, core);
+}
+
+// Ready queue wait percentiles for each priority
+void PriorityPolicy::report(simState &sim){
+
+	std::map<int, std::vector<long long>>::reverse_iterator it;
+	for(it = waits.rbegin(); it != waits.rend(); it++){
+		std::vector<long long> &band = it->second;
+		std::sort(band.begin(), band.end());
+		std::ostringstream line;
+		line << "PS priority " << it->first << ": " << band.size() << " waits, median " << std::fixed << std::setprecision(3)
+			<< percentile(band, 0.5) / 1000.0 << " msec, 90th " << percentile(band, 0.9) / 1000.0 << " msec, 99th "
+			<< percentile(band, 0.99) / 1000.0 << " msec, max " << band.back() / 1000.0 << " msec";
+		*sim.out1 << line.str() << std::endl;
+		*sim.out2 << line.str() << std::endl;
+	}
+}
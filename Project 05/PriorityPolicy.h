@@ -0,0 +1,48 @@
+/**
+ * @file	PriorityPolicy.h
+ * @brief	Definition file for PriorityPolicy class
+ * @author	Wei Tong
+ * @details Specifies all members of PriorityPolicy class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, priority scheduling with aging
+ */
+
+#ifndef PRIORITYPOLICY_H
+#define PRIORITYPOLICY_H
+
+#include "SchPolicy.h"
+#include <map>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// Priority scheduling. Each core runs the ready process with the highest
+// A{priority} from a heap, ties in the order they became ready. A waiting
+// process gains a level for every aging period it waits, so low
+// priorities are not starved. Since every waiting process ages at the
+// same rate, the heap key is fixed when the process is queued:
+// priority * aging period - time queued
+class PriorityPolicy : public SchPolicy{
+private:
+	typedef std::pair<std::pair<long long, long long>, int> readyEntry;	// ((key, -order), process)
+
+	long long agingPeriod;				// Simulated microseconds per level gained, 0 for none
+	long long order;					// Processes queued so far, breaks ties
+	std::vector<std::priority_queue<readyEntry>> heap;	// Ready processes of each core
+	std::vector<long long> readySince;	// When each process was last queued
+	std::map<int, std::vector<long long>> waits;	// Ready queue waits in usec, by priority
+
+	int take(simState &, int);
+public:
+	static const bool STREAMS = false;
+	void setup(simState &, ConfData &);
+	void onArrival(simState &, int);
+	void enqueue(simState &, int, int);
+	int pickNext(simState &, int);
+	int waiting(int);
+	int steal(simState &, int);
+	void report(simState &);
+};
+
+#endif
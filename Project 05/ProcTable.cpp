@@ -0,0 +1,121 @@
+/**
+ * @file	ProcTable.cpp
+ * @brief	Implementation of ProcTable class
+ * @author	Wei Tong
+ * @details All members of ProcTable are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires ProcTable.h
+ */
+
+#include "ProcTable.h"
+
+// Default constructor, nothing to set up
+ProcTable::ProcTable(){
+
+}
+
+// Default deconstructor, nothing to deallocate
+ProcTable::~ProcTable(){
+
+}
+
+void ProcTable::reserve(int procs){
+	pid.reserve(procs);
+	state.reserve(procs);
+	pc.reserve(procs);
+	opLeft.reserve(procs);
+	workLeft.reserve(procs);
+	keyLeft.reserve(procs);
+	memBlocks.reserve(procs);
+	device.reserve(procs);
+	unit.reserve(procs);
+	arrived.reserve(procs);
+	started.reserve(procs);
+	removed.reserve(procs);
+	since.reserve(procs);
+	runTime.reserve(procs);
+	readyTime.reserve(procs);
+	waitTime.reserve(procs);
+}
+
+int ProcTable::add(int newPid){
+	int proc = pid.size();
+	pid.resize(proc + 1);
+	state.resize(proc + 1);
+	pc.resize(proc + 1);
+	opLeft.resize(proc + 1);
+	workLeft.resize(proc + 1);
+	keyLeft.resize(proc + 1);
+	memBlocks.resize(proc + 1);
+	device.resize(proc + 1);
+	unit.resize(proc + 1);
+	arrived.resize(proc + 1);
+	started.resize(proc + 1);
+	removed.resize(proc + 1);
+	since.resize(proc + 1);
+	runTime.resize(proc + 1);
+	readyTime.resize(proc + 1);
+	waitTime.resize(proc + 1);
+	reset(proc, newPid);
+	return proc;
+}
+
+void ProcTable::reset(int proc, int newPid){
+	pid[proc] = newPid;
+	state[proc] = 0;
+	pc[proc] = 0;
+	opLeft[proc] = -1;
+	workLeft[proc] = 0;
+	keyLeft[proc] = 0;
+	memBlocks[proc] = 0;
+	device[proc] = -1;
+	unit[proc] = -1;
+	arrived[proc] = 0;
+	started[proc] = -1;
+	removed[proc] = -1;
+	since[proc] = 0;
+	runTime[proc] = 0;
+	readyTime[proc] = 0;
+	waitTime[proc] = 0;
+}
+
+int ProcTable::size(){
+	return pid.size();
+}
+
+int ProcTable::getState(int proc){
+	return state[proc];
+}
+
+// Anything outside START to EXIT is ignored, as the PCB did
+void ProcTable::setState(int proc, int newState, long long now){
+	if(newState < START || newState > EXIT)
+		return;
+	long long spent = now - since[proc];
+	if(state[proc] == RUNNING)
+		runTime[proc] += spent;
+	else if(state[proc] == READY)
+		readyTime[proc] += spent;
+	else if(state[proc] == WAITING)
+		waitTime[proc] += spent;
+	state[proc] = newState;
+	since[proc] = now;
+}
+
+int ProcTable::count(int inptState){
+	int total = 0;
+	for(unsigned int proc = 0; proc < state.size(); proc++){
+		total += state[proc] == inptState;
+	}
+	return total;
+}
+
+int ProcTable::find(int inptPid){
+	for(unsigned int proc = 0; proc < pid.size(); proc++){
+		if(pid[proc] == inptPid)
+			return proc;
+	}
+	return -1;
+}
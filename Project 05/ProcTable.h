@@ -0,0 +1,61 @@
+/**
+ * @file	ProcTable.h
+ * @brief	Definition file for ProcTable class
+ * @author	Wei Tong
+ * @details Specifies all members of ProcTable class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, replaces the PCB class with
+ *			one table holding the control block of every process
+ */
+
+#ifndef PROCTABLE_H
+#define PROCTABLE_H
+
+#include <vector>
+
+// Process states
+#define START 1
+#define READY 2
+#define RUNNING 3
+#define WAITING 4
+#define EXIT 5
+
+// Control blocks of every process, one column per field, all indexed
+// by process number. A scan over one field (every state, every pid)
+// reads a single contiguous array instead of striding over whole
+// processes, so it stays fast with millions of entries
+class ProcTable{
+public:
+	std::vector<int> pid;				// Process number shown in the log
+	std::vector<unsigned char> state;	// START to EXIT, 0 before the process is admitted
+	std::vector<int> pc;				// Operations of the process finished so far
+	std::vector<int> opLeft;			// Msec left of the processing action at the pc, -1 if not started
+	std::vector<long long> workLeft;	// Msec of processor and memory work not done yet
+	std::vector<long long> keyLeft;		// Scheduling key not used up yet, operations or msec as schAlg ranks them
+	std::vector<int> memBlocks;			// Memory blocks allocated
+	std::vector<signed char> device;	// Device type held, -1 for none
+	std::vector<int> unit;				// Unit of the device held
+
+	// Timing, simulated microseconds
+	std::vector<long long> arrived;		// Joined the simulation
+	std::vector<long long> started;		// First ran, -1 before then
+	std::vector<long long> removed;		// Removed, -1 while it runs
+	std::vector<long long> since;		// Entered its current state
+	std::vector<long long> runTime;		// Total RUNNING
+	std::vector<long long> readyTime;	// Total READY
+	std::vector<long long> waitTime;	// Total WAITING on I/O
+
+	ProcTable();							// Default constructor, no processes
+	~ProcTable();							// Default deconstructor
+	void reserve(int);						// Room for that many processes
+	int add(int);							// New process with the given pid, returns its index
+	void reset(int, int);					// Reuses a removed process's entry for a new pid
+	int size();								// Number of processes
+	int getState(int);						// State of a process
+	void setState(int, int, long long);		// Moves a process to a state at a time, adds up the time in the old one
+	int count(int);							// Processes in a state
+	int find(int);							// Index of the process with a pid, -1 if none
+};
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file	SchPolicy.cpp
+ * @brief	Implementation of the scheduling policies
+ * @author	Wei Tong
+ * @details All members of SchPolicy, RoundRobinPolicy and
+ *			ShortestPolicy are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires SchPolicy.h
+ */
+
+#include "SchPolicy.h"
+
+void SchPolicy::setup(simState &sim, ConfData &schConf){
+	ready.assign(sim.cores.size(), std::deque<int>());
+}
+
+void SchPolicy::onArrival(simState &sim, int proc){
+
+}
+
+void SchPolicy::enqueue(simState &sim, int core, int proc){
+	ready[core].push_back(proc);
+}
+
+// Ties keep their arrival order
+void SchPolicy::insertByKey(simState &sim, int core, int proc){
+
+	std::deque<int>::iterator pos = ready[core].begin();
+	while(pos != ready[core].end() && sim.table.keyLeft[*pos] <= sim.table.keyLeft[proc]){
+		pos++;
+	}
+	ready[core].insert(pos, proc);
+}
+
+int SchPolicy::pickNext(simState &sim, int core){
+	if(ready[core].empty())
+		return -1;
+	int proc = ready[core].front();
+	ready[core].pop_front();
+	return proc;
+}
+
+int SchPolicy::waiting(int core){
+	return ready[core].size();
+}
+
+// Takes from the back, leaving the front (the next process in
+// scheduling order) to the core that owns the queue
+int SchPolicy::steal(simState &sim, int core){
+	if(ready[core].empty())
+		return -1;
+	int proc = ready[core].back();
+	ready[core].pop_back();
+	return proc;
+}
+
+int SchPolicy::quantum(simState &sim, int proc){
+	return 0;
+}
+
+void SchPolicy::charge(simState &sim, int proc, int msec){
+
+}
+
+int SchPolicy::preemptTarget(simState &sim, int proc){
+	return -1;
+}
+
+void SchPolicy::onExit(simState &sim, int proc){
+
+}
+
+void SchPolicy::report(simState &sim){
+
+}
+
+long long percentile(const std::vector<long long> &sorted, double fraction){
+
+	if(sorted.empty())
+		return 0;
+	unsigned int rank = fraction * sorted.size();
+	if(rank >= sorted.size())
+		rank = sorted.size() - 1;
+	return sorted[rank];
+}
+
+void RoundRobinPolicy::setup(simState &sim, ConfData &schConf){
+	SchPolicy::setup(sim, schConf);
+	slice = schConf.get_pqn();
+}
+
+int RoundRobinPolicy::quantum(simState &sim, int proc){
+	return slice;
+}
+
+void SjfPolicy::setup(simState &sim, ConfData &schConf){
+	SchPolicy::setup(sim, schConf);
+	started = false;
+}
+
+// Live arrivals and processes back from I/O go ahead of longer jobs
+void SjfPolicy::enqueue(simState &sim, int core, int proc){
+	if(started)
+		insertByKey(sim, core, proc);
+	else
+		ready[core].push_back(proc);
+}
+
+int SjfPolicy::pickNext(simState &sim, int core){
+	started = true;
+	return SchPolicy::pickNext(sim, core);
+}
+
+void ShortestPolicy::enqueue(simState &sim, int core, int proc){
+	insertByKey(sim, core, proc);
+}
+
+// Scheduling key left of the process running on a core. A Time key
+// counts the part of its current slice that has already gone by
+long long ShortestPolicy::keyNow(simState &sim, int core){
+
+	int proc = sim.cores[core].running;
+	if(!sim.timeKey)
+		return sim.table.keyLeft[proc];
+	long long elapsed = (sim.clock->now() - sim.cores[core].busySince) / 1000;
+	if(elapsed > sim.procs[proc].sliceLen)
+		elapsed = sim.procs[proc].sliceLen;
+	return sim.table.keyLeft[proc] - elapsed;
+}
+
+int ShortestPolicy::preemptTarget(simState &sim, int proc){
+
+	int victim = -1;
+	long long most = -1;
+	for(unsigned int core = 0; core < sim.cores.size(); core++){
+		int running = sim.cores[core].running;
+
+		// An idle core will pick the process up anyway
+		if(running == -1)
+			return -1;
+
+		// Only processing actions can be interrupted
+		if(currentOp(sim, running).getCode() != 'P')
+			continue;
+		long long left = keyNow(sim, core);
+		if(left > most){
+			most = left;
+			victim = core;
+		}
+	}
+	if(victim == -1 || sim.table.keyLeft[proc] >= most)
+		return -1;
+	return victim;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file	SchPolicy.h
+ * @brief	Definition file for the scheduling policies
+ * @author	Wei Tong
+ * @details Specifies the scheduling policies built into the
+ *			simulator. The simulator loop is a template over the
+ *			policy, so every hook is a plain member function call
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, FIFO, RR and STR
+ */
+
+#ifndef SCHPOLICY_H
+#define SCHPOLICY_H
+
+#include "SimState.h"
+#include <deque>
+#include <vector>
+
+// Every policy has these hooks. A policy derives from SchPolicy and
+// hides the ones it changes, the simulator only calls them through
+// the policy's own type
+//	setup(sim, conf)			once the cores exist
+//	onArrival(sim, proc)		a process joins, before it is first ready
+//	enqueue(sim, core, proc)	a process is ready on a core
+//	pickNext(sim, core)			takes the next process for a core, -1 if none
+//	waiting(core)				number of ready processes on a core
+//	steal(sim, core)			takes a process off a core for another one, -1 if none
+//	quantum(sim, proc)			longest slice of a processing action, 0 for no limit
+//	charge(sim, proc, msec)		the process ran on its core for msec
+//	preemptTarget(sim, proc)	core a newly ready process takes over, -1 for none
+//	onExit(sim, proc)			the process was removed
+//	report(sim)					prints the policy's own statistics after the run
+//	PREEMPTIVE					processing actions can be interrupted
+//	STREAMS						keeps nothing of its own for a removed process, so
+//								a streamed process can take over its entry
+
+// First come first served, one ready queue per core
+class SchPolicy{
+protected:
+	std::vector<std::deque<int>> ready;	// Ready queue of each core
+
+	void insertByKey(simState &, int, int);	// Ahead of the first process with more of its scheduling key left
+public:
+	static const bool PREEMPTIVE = false;
+	static const bool STREAMS = true;
+	void setup(simState &, ConfData &);
+	void onArrival(simState &, int);
+	void enqueue(simState &, int, int);
+	int pickNext(simState &, int);
+	int waiting(int);
+	int steal(simState &, int);
+	int quantum(simState &, int);
+	void charge(simState &, int, int);
+	int preemptTarget(simState &, int);
+	void onExit(simState &, int);
+	void report(simState &);
+};
+
+// Value below which the given fraction of the sorted samples fall
+long long percentile(const std::vector<long long> &, double);
+
+// Round Robin, processing actions run in slices of the processor quantum
+class RoundRobinPolicy : public SchPolicy{
+private:
+	int slice;	// Processor quantum in msec
+public:
+	static const bool PREEMPTIVE = true;
+	void setup(simState &, ConfData &);
+	int quantum(simState &, int);
+};
+
+// Shortest Job First. The loaded processes are dealt in schAlg's order,
+// once the run has begun a process that becomes ready is placed by the
+// scheduling key it has left, the one schAlg ranked by. A running
+// process is never interrupted
+class SjfPolicy : public SchPolicy{
+private:
+	bool started;	// The first process was picked, the deal is over
+public:
+	void setup(simState &, ConfData &);
+	void enqueue(simState &, int, int);
+	int pickNext(simState &, int);
+};
+
+// Shortest Time Remaining, ready queues ordered by the scheduling key
+// left and a process that becomes ready takes over the core running the
+// most of it
+class ShortestPolicy : public SchPolicy{
+private:
+	long long keyNow(simState &, int);
+public:
+	static const bool PREEMPTIVE = true;
+	void enqueue(simState &, int, int);
+	int preemptTarget(simState &, int);
+};
+
+#endif
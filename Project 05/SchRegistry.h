@@ -0,0 +1,38 @@
+/**
+ * @file	SchRegistry.h
+ * @brief	Lists the scheduling policies the simulator is built with
+ * @author	Wei Tong
+ * @details Maps each CPU Scheduling Code to the policy class that
+ *			runs it. sim05.cpp builds one simulator loop per entry
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	To add a policy, derive it from SchPolicy in its own
+ *			.h/.cpp, include the header here, add a line to
+ *			SCH_POLICIES and add its object file to the makefile
+ */
+
+#ifndef SCHREGISTRY_H
+#define SCHREGISTRY_H
+
+#include "SchPolicy.h"
+#include "MlfqPolicy.h"
+#include "CfsPolicy.h"
+#include "SharePolicy.h"
+#include "EdfPolicy.h"
+#include "PriorityPolicy.h"
+
+// X(code, policy class)
+#define SCH_POLICIES(X) \
+	X("FIFO", SchPolicy) \
+	X("PS", PriorityPolicy) \
+	X("SJF", SjfPolicy) \
+	X("RR", RoundRobinPolicy) \
+	X("STR", ShortestPolicy) \
+	X("MLFQ", MlfqPolicy) \
+	X("CFS", CfsPolicy) \
+	X("LOT", LotteryPolicy) \
+	X("STRIDE", StridePolicy) \
+	X("EDF", EdfPolicy)
+
+#endif
@@ -0,0 +1,237 @@
+/**
+ * @file	SharePolicy.cpp
+ * @brief	Implementation of the proportional share policies
+ * @author	Wei Tong
+ * @details All members of ShareTally, LotteryPolicy and
+ *			StridePolicy are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires SharePolicy.h
+ */
+
+#include "SharePolicy.h"
+#include <iomanip>
+#include <sstream>
+
+// Stride of a process holding one ticket
+#define STRIDE_ONE (1 << 20)
+
+void ShareTally::setup(int numCores){
+	readyTickets.assign(numCores, std::map<int, long long>());
+	readyTotal.assign(numCores, 0);
+}
+
+void ShareTally::add(int core, int tickets){
+	readyTickets[core][tickets] += tickets;
+	readyTotal[core] += tickets;
+}
+
+void ShareTally::remove(int core, int tickets){
+	readyTickets[core][tickets] -= tickets;
+	if(readyTickets[core][tickets] == 0)
+		readyTickets[core].erase(tickets);
+	readyTotal[core] -= tickets;
+}
+
+void ShareTally::pick(int core, int tickets){
+
+	std::map<int, long long>::iterator it;
+	for(it = readyTickets[core].begin(); it != readyTickets[core].end(); it++){
+		owed[it->first] += (double)it->second / readyTotal[core];
+	}
+	won[tickets]++;
+}
+
+void ShareTally::report(std::string name, std::ostream& out1, std::ostream& out2){
+
+	std::map<int, double>::iterator it;
+	for(it = owed.begin(); it != owed.end(); it++){
+		std::ostringstream line;
+		line << name << ": " << it->first << " tickets won " << won[it->first] << " picks, owed "
+			<< std::fixed << std::setprecision(1) << it->second;
+		out1 << line.str() << std::endl;
+		out2 << line.str() << std::endl;
+	}
+}
+
+void LotteryPolicy::setup(simState &sim, ConfData &schConf){
+	slice = schConf.get_pqn();
+	capacity = 0;
+	prefix.assign(sim.cores.size(), std::vector<long long>(1, 0));
+	held.assign(sim.cores.size(), std::vector<int>());
+	total.assign(sim.cores.size(), 0);
+	count.assign(sim.cores.size(), 0);
+	draw.seed(1);
+	tally.setup(sim.cores.size());
+}
+
+// Makes room for n processes, doubling so arrivals rebuild the
+// trees only O(log n) times
+void LotteryPolicy::grow(int n){
+
+	if(n <= capacity)
+		return;
+	int newCap = capacity * 2 > n ? capacity * 2 : n;
+	for(unsigned int core = 0; core < prefix.size(); core++){
+		held[core].resize(newCap, 0);
+		prefix[core].assign(newCap + 1, 0);
+		for(int i = 1; i <= newCap; i++){
+			prefix[core][i] += held[core][i - 1];
+			int up = i + (i & -i);
+			if(up <= newCap)
+				prefix[core][up] += prefix[core][i];
+		}
+	}
+	capacity = newCap;
+}
+
+void LotteryPolicy::update(int core, int proc, long long delta){
+	for(int i = proc + 1; i <= capacity; i += i & -i){
+		prefix[core][i] += delta;
+	}
+}
+
+// Draws a ticket and walks down the tree to the process holding it
+int LotteryPolicy::winner(int core){
+
+	std::uniform_int_distribution<long long> ticket(0, total[core] - 1);
+	long long left = ticket(draw);
+	int pos = 0;
+	int step = 1;
+	while(step * 2 <= capacity){
+		step *= 2;
+	}
+	for(; step > 0; step /= 2){
+		if(pos + step <= capacity && prefix[core][pos + step] <= left){
+			pos += step;
+			left -= prefix[core][pos];
+		}
+	}
+	return pos;
+}
+
+// Takes the process out of the core's tree. A pick is tallied while
+// the winner is still in the ready set, as the draw saw it
+int LotteryPolicy::take(simState &sim, int core, bool picked){
+
+	int proc = winner(core);
+	int tickets = held[core][proc];
+	if(picked)
+		tally.pick(core, tickets);
+	update(core, proc, -tickets);
+	held[core][proc] = 0;
+	total[core] -= tickets;
+	count[core]--;
+	tally.remove(core, tickets);
+	return proc;
+}
+
+void LotteryPolicy::onArrival(simState &sim, int proc){
+	grow(sim.procs.size());
+}
+
+void LotteryPolicy::enqueue(simState &sim, int core, int proc){
+
+	int tickets = sim.procs[proc].tickets;
+	held[core][proc] = tickets;
+	update(core, proc, tickets);
+	total[core] += tickets;
+	count[core]++;
+	tally.add(core, tickets);
+}
+
+int LotteryPolicy::pickNext(simState &sim, int core){
+
+	if(count[core] == 0)
+		return -1;
+	return take(sim, core, true);
+}
+
+int LotteryPolicy::waiting(int core){
+	return count[core];
+}
+
+// A stolen process is drawn the same way
+int LotteryPolicy::steal(simState &sim, int core){
+
+	if(count[core] == 0)
+		return -1;
+	return take(sim, core, false);
+}
+
+// Without a processor quantum a win runs the processing action to the end
+int LotteryPolicy::quantum(simState &sim, int proc){
+	return slice > 0 ? slice : 0;
+}
+
+void LotteryPolicy::report(simState &sim){
+	tally.report("Lottery", *sim.out1, *sim.out2);
+}
+
+void StridePolicy::setup(simState &sim, ConfData &schConf){
+	slice = schConf.get_pqn();
+	heap.assign(sim.cores.size(), passHeap());
+	globalPass.assign(sim.cores.size(), 0);
+	tally.setup(sim.cores.size());
+}
+
+long long StridePolicy::stride(simState &sim, int proc){
+	return STRIDE_ONE / sim.procs[proc].tickets;
+}
+
+// A new process starts level with the core it is dealt to
+void StridePolicy::onArrival(simState &sim, int proc){
+	pass.resize(sim.procs.size(), 0);
+	pass[proc] = globalPass[sim.nextCore];
+}
+
+// A process back from I/O is not owed the time it spent blocked
+void StridePolicy::enqueue(simState &sim, int core, int proc){
+
+	if(pass[proc] < globalPass[core])
+		pass[proc] = globalPass[core];
+	heap[core].push(std::make_pair(pass[proc], proc));
+	tally.add(core, sim.procs[proc].tickets);
+}
+
+int StridePolicy::pickNext(simState &sim, int core){
+
+	if(heap[core].empty())
+		return -1;
+	int proc = heap[core].top().second;
+	tally.pick(core, sim.procs[proc].tickets);
+	heap[core].pop();
+	tally.remove(core, sim.procs[proc].tickets);
+	if(pass[proc] > globalPass[core])
+		globalPass[core] = pass[proc];
+	return proc;
+}
+
+int StridePolicy::waiting(int core){
+	return heap[core].size();
+}
+
+// The heap only gives up its lowest pass, so that is what is stolen
+int StridePolicy::steal(simState &sim, int core){
+
+	if(heap[core].empty())
+		return -1;
+	int proc = heap[core].top().second;
+	heap[core].pop();
+	tally.remove(core, sim.procs[proc].tickets);
+	return proc;
+}
+
+// Without a processor quantum the process runs its processing action to the end
+int StridePolicy::quantum(simState &sim, int proc){
+	return slice > 0 ? slice : 0;
+}
+
+void StridePolicy::charge(simState &sim, int proc, int msec){
+	pass[proc] += stride(sim, proc) * msec;
+}
+
+void StridePolicy::report(simState &sim){
+	tally.report("Stride", *sim.out1, *sim.out2);
+}
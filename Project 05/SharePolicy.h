@@ -0,0 +1,101 @@
+/**
+ * @file	SharePolicy.h
+ * @brief	Definition file for the proportional share policies
+ * @author	Wei Tong
+ * @details Specifies all members of ShareTally, LotteryPolicy and
+ *			StridePolicy classes
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, lottery and stride scheduling
+ */
+
+#ifndef SHAREPOLICY_H
+#define SHAREPOLICY_H
+
+#include "SchPolicy.h"
+#include <map>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Checks that the processor divides in proportion to the tickets.
+// At every pick each ticket count present in the ready set is owed
+// its share of the tickets, the report compares that with the picks
+// processes holding that many tickets actually won
+class ShareTally{
+private:
+	std::vector<std::map<int, long long>> readyTickets;	// Tickets ready on each core, by ticket count
+	std::vector<long long> readyTotal;					// Tickets ready on each core
+	std::map<int, double> owed;
+	std::map<int, long long> won;
+public:
+	void setup(int);							// Sets the number of cores
+	void add(int, int);							// A process with the tickets is ready on the core
+	void remove(int, int);						// It left the core's ready set
+	void pick(int, int);						// The core picked a process with the tickets
+	void report(std::string, std::ostream&, std::ostream&);
+};
+
+// Lottery scheduling. Each core keeps the tickets of its ready processes
+// in a Fenwick tree of prefix sums indexed by process, so drawing the
+// winning ticket and adding or removing a process are O(log n)
+class LotteryPolicy : public SchPolicy{
+private:
+	int slice;								// Processor quantum in msec
+	int capacity;							// Processes the trees have room for
+	std::vector<std::vector<long long>> prefix;	// Fenwick tree of each core, 1 indexed
+	std::vector<std::vector<int>> held;		// Tickets each process has in each core's tree
+	std::vector<long long> total;			// Tickets in each core's tree
+	std::vector<int> count;					// Processes in each core's tree
+	std::mt19937 draw;						// Fixed seed, runs repeat
+	ShareTally tally;
+
+	void grow(int);
+	void update(int, int, long long);
+	int winner(int);
+	int take(simState &, int, bool);
+public:
+	static const bool PREEMPTIVE = true;
+	static const bool STREAMS = false;
+	void setup(simState &, ConfData &);
+	void onArrival(simState &, int);
+	void enqueue(simState &, int, int);
+	int pickNext(simState &, int);
+	int waiting(int);
+	int steal(simState &, int);
+	int quantum(simState &, int);
+	void report(simState &);
+};
+
+// Stride scheduling. Each process advances its pass by its stride, one
+// over its tickets, for every msec it runs, and each core runs the ready
+// process with the lowest pass from a heap, O(log n)
+class StridePolicy : public SchPolicy{
+private:
+	typedef std::priority_queue<std::pair<long long, int>, std::vector<std::pair<long long, int>>,
+		std::greater<std::pair<long long, int>>> passHeap;	// (pass, process)
+
+	int slice;								// Processor quantum in msec
+	std::vector<passHeap> heap;				// Ready processes of each core
+	std::vector<long long> globalPass;		// Pass of the process each core picked last
+	std::vector<long long> pass;			// Pass of each process
+	ShareTally tally;
+
+	long long stride(simState &, int);
+public:
+	static const bool PREEMPTIVE = true;
+	static const bool STREAMS = false;
+	void setup(simState &, ConfData &);
+	void onArrival(simState &, int);
+	void enqueue(simState &, int, int);
+	int pickNext(simState &, int);
+	int waiting(int);
+	int steal(simState &, int);
+	int quantum(simState &, int);
+	void charge(simState &, int, int);
+	void report(simState &);
+};
+
+#endif
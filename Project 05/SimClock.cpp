@@ -0,0 +1,70 @@
+/**
+ * @file	SimClock.cpp
+ * @brief	Implementation of SimClock class
+ * @author	Wei Tong
+ * @details All members of SimClock are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires SimClock.h
+ */
+
+#include "SimClock.h"
+
+// Default constructor, runs against the wall clock
+SimClock::SimClock(){
+	virtualMode = false;
+	virtualTime = 0;
+	speed = 1;
+	refPoint = std::chrono::steady_clock::now();
+}
+
+// Default deconstructor, nothing to deallocate
+SimClock::~SimClock(){
+
+}
+
+void SimClock::setVirtual(bool inptMode){
+	virtualMode = inptMode;
+}
+
+bool SimClock::isVirtual(){
+	return virtualMode;
+}
+
+void SimClock::start(){
+	virtualTime = 0;
+	refPoint = std::chrono::steady_clock::now();
+}
+
+long long SimClock::now(){
+	if(virtualMode)
+		return virtualTime;
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - refPoint).count() * speed;
+}
+
+// Virtual time never runs backwards, an event in the past
+// is treated as happening right now
+void SimClock::advanceTo(long long eventTime){
+	if(virtualMode && eventTime > virtualTime)
+		virtualTime = eventTime;
+}
+
+void SimClock::advance(int msec){
+	if(virtualMode && msec > 0)
+		virtualTime += (long long)msec * 1000;
+}
+
+// Anything that is not a positive factor keeps real time
+void SimClock::setSpeed(double inptSpeed){
+	if(inptSpeed > 0)
+		speed = inptSpeed;
+}
+
+double SimClock::getSpeed(){
+	return speed;
+}
+
+long long SimClock::realTime(long long msec){
+	return (long long)(msec * 1000 / speed);
+}
@@ -0,0 +1,38 @@
+/**
+ * @file	SimClock.h
+ * @brief	Definition file for SimClock class
+ * @author	Wei Tong
+ * @details Specifies all members of SimClock class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, keeps simulated time either
+ *			against the wall clock or as a virtual clock that
+ *			jumps straight to the next event
+ */
+
+#ifndef SIMCLOCK_H
+#define SIMCLOCK_H
+
+#include <chrono>
+
+class SimClock{
+private:
+	bool virtualMode;		// True when time only moves on events
+	long long virtualTime;	// Current simulated time in microseconds (virtual mode)
+	double speed;			// Simulated time per unit of real time (real mode)
+	std::chrono::steady_clock::time_point refPoint;	// Time zero (real mode)
+public:
+	SimClock();								// Default constructor, real time
+	~SimClock();							// Default deconstructor
+	void setVirtual(bool);					// Selects virtual or real time
+	bool isVirtual();						// Retrieves the clock mode
+	void start();							// Marks time zero of the simulation
+	long long now();						// Simulated microseconds since time zero
+	void advanceTo(long long);				// Moves the virtual clock to an event time
+	void advance(int);						// Moves the virtual clock forward in msec
+	void setSpeed(double);					// Sets the time dilation factor
+	double getSpeed();						// Retrieves the time dilation factor
+	long long realTime(long long);			// Real microseconds that simulate msec
+};
+
+#endif
@@ -0,0 +1,162 @@
+/**
+ * @file	SimState.h
+ * @brief	Definition file for the simulator state
+ * @author	Wei Tong
+ * @details Specifies the processes, cores, devices and timer
+ *			packages the simulator loop works on
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, moved out of sim05.cpp so
+ *			scheduling policies can see the processes and cores
+ */
+
+#ifndef SIMSTATE_H
+#define SIMSTATE_H
+
+#include "ConfData.h"
+#include "MetaObj.h"
+#include "Workload.h"
+#include "ProcTable.h"
+#include "SimClock.h"
+#include "EventQueue.h"
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+#include <pthread.h>
+#include <semaphore.h>
+
+class MdfStream;
+
+// Shared device types
+#define DEV_HDD 0
+#define DEV_PROJ 1
+
+struct timerPackage{
+
+	int countTime = 0;	// Time to count down
+	bool contRun = true;	// Helper to stop thread
+	SimClock* clock = NULL;
+
+	// v6.0, the engine hands a count down to the timer thread under
+	// timer_lock, the timer thread posts finished to the event queue
+	bool pending = false;	// A count down is waiting for the timer thread
+	bool active = false;	// The timer thread is counting down
+	bool cancel = false;	// Cut the running count down short
+	SimEvent finished;
+	EventQueue* events = NULL;
+	pthread_mutex_t timer_lock;
+	pthread_cond_t timer_request;
+};
+
+struct ioPackage{
+
+	int io_time;
+	char io_operation;
+
+	// v3.0
+	// v6.0, point at the device pool, NULL for devices that are not shared
+	sem_t* io_sem;
+	pthread_mutex_t* io_lock;
+
+	// v6.0
+	SimClock* clock;
+	EventQueue* events;
+	SimEvent finished;	// Posted once the operation is over
+};
+
+// v6.0, one process of the workload, its control block is its entry
+// in the process table and its operations are its span of the program
+struct simProcess{
+
+	int core = 0;				// Core whose ready queue the process goes back to
+	int sliceLen = 0;			// Msec of it running in the current slice
+	long long sliceToken = 0;	// Matches the event that ends the current slice
+	int nice = 0;				// A{nice} in the meta data, -20 to 19, weights fair share policies
+	int tickets = 100;			// A{tickets} in the meta data, share under lottery and stride
+	int deadline = 0;			// A{deadline} in the meta data, msec after arrival, 0 for none
+	int period = 0;				// A{period} in the meta data, msec between releases, 0 for none
+	int priority = 0;			// A{priority} in the meta data, higher runs first under PS
+	bool streamed = false;		// Came from the meta data stream, its entry is reused once it is removed
+
+	// Real mode, the thread running the current I/O operation
+	pthread_t io_thread;
+	ioPackage* io_data = NULL;
+};
+
+// v6.0, a manageable resource (hard drives, projectors)
+struct devicePool{
+
+	std::string name;			// Shown in the log
+	std::vector<bool> busy;
+	int last = -1;				// Last unit handed out, units go round robin
+	std::queue<int> waiting;	// Processes blocked until a unit frees up
+
+	// Real mode, held by the I/O thread using a unit
+	sem_t free_units;
+	std::vector<pthread_mutex_t> unit_lock;
+};
+
+// v6.0, one simulated processor core
+struct coreState{
+
+	int running = -1;			// Process on the core, -1 when idle
+	int lastProc = -1;			// Process that ran on the core before
+	timerPackage timer;			// Real mode, times operations on this core
+	pthread_t timer_thread;
+
+	// Load balancing statistics
+	long long busy = 0;			// Simulated microseconds spent running operations
+	long long busySince = 0;	// Start of the operation currently running
+	int steals = 0;				// Processes taken from other cores' ready queues
+};
+
+// v6.0, everything the simulator loop works on
+struct simState{
+
+	SimClock* clock;
+	EventQueue* events;
+	std::ostream* out1;
+	std::ostream* out2;
+
+	std::vector<simProcess> procs;
+	ProcTable table;			// Control blocks, indexed like procs
+	Workload program;			// Operations of every admitted process, spans indexed like procs
+	std::vector<coreState> cores;
+	int finished = 0;			// Processes that have been removed
+	ConfData* conf;				// Arrivals are scheduled with it
+	bool timeKey = false;		// The policy's Scheduling key is Time, not Operations
+	int nextCore = 0;			// Core the next arriving process is dealt to
+	int arrivalsPending = 0;	// Loads and generated processes still to come
+	long long contextSwitches = 0;	// A core picked up a different process than it last ran
+	long long preemptions = 0;	// Processing actions interrupted by the quantum or an arrival
+	long long lastLogged = 0;	// Time stamp of the last log line
+
+	// Streaming the meta data file, processes beyond the window wait in
+	// the stream and removed ones hand their entries to new ones
+	MdfStream* stream = NULL;	// NULL when the file was loaded whole or has been read
+	int streamWindow = 0;		// Most streamed processes in the simulation at once
+	int streamed = 0;			// Streamed processes not removed yet
+	std::vector<int> freeSlots;	// Entries of removed streamed processes
+	int recycled = 0;			// Processes whose entries were taken over
+	int pidsUsed = 0;			// Pids handed out or held for the later parts of a split file
+	std::vector<int> fileBase;	// Pid before the first process of each split file, -1 until it is reached
+	int deadOps = 0;			// Operations in the program of removed streamed processes
+
+	devicePool devices[2];		// DEV_HDD, DEV_PROJ
+
+	int monT, procT, scanT, hdT, keyT, memT, projT;
+	int max_mem, last_mem_addr, mem_block;
+};
+
+// v6.0, operation at a process's program counter
+inline MetaObj &currentOp(simState &sim, int proc){
+	return sim.program.ops[sim.program.procs[proc].begin + sim.table.pc[proc]];
+}
+
+// True once the program counter is past the process's last operation
+inline bool opsDone(simState &sim, int proc){
+	return sim.program.procs[proc].begin + sim.table.pc[proc] >= sim.program.procs[proc].end;
+}
+
+#endif
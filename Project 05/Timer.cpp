@@ -0,0 +1,184 @@
+/**
+ * @file	Timer.cpp
+ * @brief	Implementation of Timer class
+ * @author	Wei Tong
+ * @details All members of Timer are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires Timer.h
+ */
+
+#include "Timer.h"
+#include <errno.h>
+
+#define NSEC_PER_SEC 1000000000LL
+
+// Helpers for timespec arithmetic
+static long long toNsec(const timespec &ts){
+	return (long long)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+static timespec fromNsec(long long nsec){
+	timespec ts;
+	ts.tv_sec = nsec / NSEC_PER_SEC;
+	ts.tv_nsec = nsec % NSEC_PER_SEC;
+	return ts;
+}
+
+// Default constructor, sleeps most of the wait and spins the last 200 usec
+Timer::Timer(){
+	timerMode = TIMER_HYBRID;
+	spinTail = 200;
+	wakeups = 0;
+	totalOvershoot = 0;
+	maxOvershoot = 0;
+	pthread_mutex_init(&statLock, NULL);
+}
+
+Timer::~Timer(){
+	pthread_mutex_destroy(&statLock);
+}
+
+void Timer::setMode(int inptMode){
+	if(inptMode >= TIMER_SPIN && inptMode <= TIMER_SLEEP)
+		timerMode = inptMode;
+}
+
+int Timer::getMode(){
+	return timerMode;
+}
+
+void Timer::setSpinTail(long inptTail){
+	if(inptTail >= 0)
+		spinTail = inptTail;
+}
+
+long Timer::getSpinTail(){
+	return spinTail;
+}
+
+void Timer::spinUntil(const timespec &deadline){
+
+	long long target = toNsec(deadline);
+	timespec now;
+	do{
+		clock_gettime(CLOCK_MONOTONIC, &now);
+	}while(toNsec(now) < target);
+}
+
+void Timer::sleepUntil(const timespec &deadline){
+
+	// Restart after signals, the deadline is absolute so nothing drifts
+	while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR){
+	}
+}
+
+void Timer::waitFor(long long usec){
+
+	waitUntil(after(usec));
+}
+
+void Timer::waitUntil(const timespec &deadline){
+
+	if(timerMode == TIMER_SPIN){
+		spinUntil(deadline);
+	}
+	else if(timerMode == TIMER_SLEEP){
+		sleepUntil(deadline);
+	}
+	else{
+		sleepUntil(fromNsec(toNsec(deadline) - (long long)spinTail * 1000));
+		spinUntil(deadline);
+	}
+
+	record(deadline);
+}
+
+// Caller holds lock, and wake must be a CLOCK_MONOTONIC condition.
+// Whoever sets *cancel under lock and signals wake cuts the wait
+// short. Returns true if the wait was cut short, lock is held again
+// on return
+bool Timer::waitUntil(const timespec &deadline, pthread_mutex_t* lock, pthread_cond_t* wake, const bool* cancel){
+
+	if(timerMode != TIMER_SPIN){
+		timespec sleepEnd = deadline;
+		if(timerMode == TIMER_HYBRID)
+			sleepEnd = fromNsec(toNsec(deadline) - (long long)spinTail * 1000);
+		while(!*cancel){
+			if(pthread_cond_timedwait(wake, lock, &sleepEnd) == ETIMEDOUT)
+				break;
+		}
+	}
+
+	// Spin the rest, letting go of the lock so the wait can be cancelled
+	long long target = toNsec(deadline);
+	timespec now;
+	while(!*cancel){
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if(toNsec(now) >= target)
+			break;
+		pthread_mutex_unlock(lock);
+		pthread_mutex_lock(lock);
+	}
+
+	if(*cancel)
+		return true;
+	record(deadline);
+	return false;
+}
+
+timespec Timer::after(long long usec){
+
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return fromNsec(toNsec(now) + usec * 1000);
+}
+
+// Records how late a wakeup was
+void Timer::record(const timespec &deadline){
+
+	timespec woke;
+	clock_gettime(CLOCK_MONOTONIC, &woke);
+	long long late = toNsec(woke) - toNsec(deadline);
+	if(late < 0)
+		late = 0;
+
+	pthread_mutex_lock(&statLock);
+	wakeups++;
+	totalOvershoot += late;
+	if(late > maxOvershoot)
+		maxOvershoot = late;
+	pthread_mutex_unlock(&statLock);
+}
+
+long long Timer::getWakeups(){
+	pthread_mutex_lock(&statLock);
+	long long count = wakeups;
+	pthread_mutex_unlock(&statLock);
+	return count;
+}
+
+long long Timer::getMeanOvershoot(){
+	pthread_mutex_lock(&statLock);
+	long long mean = wakeups ? totalOvershoot / wakeups : 0;
+	pthread_mutex_unlock(&statLock);
+	return mean;
+}
+
+long long Timer::getMaxOvershoot(){
+	pthread_mutex_lock(&statLock);
+	long long worst = maxOvershoot;
+	pthread_mutex_unlock(&statLock);
+	return worst;
+}
+
+void Timer::report(std::ostream& out1, std::ostream& out2){
+
+	long long count = getWakeups();
+	long long mean = getMeanOvershoot();
+	long long worst = getMaxOvershoot();
+
+	out1 << std::dec << "Timer: " << count << " wakeups, mean overshoot " << mean / 1000 << " usec, max overshoot " << worst / 1000 << " usec" << std::endl;
+	out2 << std::dec << "Timer: " << count << " wakeups, mean overshoot " << mean / 1000 << " usec, max overshoot " << worst / 1000 << " usec" << std::endl;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file	Timer.h
+ * @brief	Definition file for Timer class
+ * @author	Wei Tong
+ * @details Specifies all members of Timer class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, replaces the busy wait in
+ *			waitTime with a sleep followed by a short spin
+ */
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <iostream>
+#include <pthread.h>
+#include <time.h>
+
+#define TIMER_SPIN 1	// Spin for the whole wait, most accurate, one core per waiter
+#define TIMER_HYBRID 2	// Sleep, then spin for the last spinTail microseconds
+#define TIMER_SLEEP 3	// Sleep for the whole wait, least CPU, wakes late by the scheduler slack
+
+class Timer{
+private:
+	int timerMode;
+	long spinTail;				// Microseconds spun at the end of a hybrid wait
+
+	// Wakeup statistics, shared by every thread that waits
+	long long wakeups;
+	long long totalOvershoot;	// Nanoseconds
+	long long maxOvershoot;		// Nanoseconds
+	pthread_mutex_t statLock;
+
+	void spinUntil(const timespec &);
+	void sleepUntil(const timespec &);
+	void record(const timespec &);
+public:
+	Timer();								// Default constructor, hybrid mode
+	~Timer();								// Default deconstructor
+	void setMode(int);						// Sets the accuracy vs CPU mode
+	int getMode();							// Retrieves the mode
+	void setSpinTail(long);					// Sets the spin tail in microseconds
+	long getSpinTail();						// Retrieves the spin tail
+	void waitFor(long long);				// Waits for the given microseconds
+	void waitUntil(const timespec &);		// Waits until a CLOCK_MONOTONIC deadline
+	bool waitUntil(const timespec &, pthread_mutex_t*, pthread_cond_t*, const bool*);	// Same, but can be cut short
+	timespec after(long long);				// Deadline the given microseconds from now
+	long long getWakeups();					// Number of finished waits
+	long long getMeanOvershoot();			// Mean lateness of a wakeup in nanoseconds
+	long long getMaxOvershoot();			// Worst lateness of a wakeup in nanoseconds
+	void report(std::ostream&, std::ostream&);	// Prints the wakeup statistics
+};
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * @file	Workload.cpp
+ * @brief	Implementation of Workload class
+ * @author	Wei Tong
+ * @details All members of Workload are implemented
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development
+ * @note	Requires Workload.h
+ */
+
+#include "Workload.h"
+#include <algorithm>
+#include <utility>
+
+// Default constructor, no operations yet
+Workload::Workload(){
+	open = false;
+	file = -1;
+	fileProcs = 0;
+}
+
+// Default deconstructor, nothing to deallocate
+Workload::~Workload(){
+
+}
+
+// A process without an A{finish} ends at the next A{begin} or S
+// operation, so S{begin} and S{finish} stay outside every span
+void Workload::push(MetaObj op){
+
+	int at = ops.size();
+	bool begin = op.getCode() == 'A' && op.getDesc() == DESC_BEGIN;
+	if(open && (op.getCode() == 'S' || begin))
+		open = false;
+	if(begin){
+		opSpan span;
+		span.begin = at;
+		procs.push_back(span);
+		open = true;
+	}
+	bool finish = op.getCode() == 'A' && op.getDesc() == DESC_FINISH;
+	ops.push_back(std::move(op));
+	if(open){
+		procs.back().end = at + 1;
+		if(finish)
+			open = false;
+	}
+}
+
+void Workload::take(Workload &from, opSpan span){
+	procs.push_back(append(from, span));
+}
+
+// The other workload keeps its operations, they are plain copies
+opSpan Workload::append(Workload &from, opSpan span){
+	open = false;
+	opSpan added;
+	added.begin = ops.size();
+	ops.insert(ops.end(), from.ops.begin() + span.begin, from.ops.begin() + span.end);
+	added.end = ops.size();
+	return added;
+}
+
+// Spans keep the other workload's scheduling order. An empty workload
+// takes the other one's array as it is
+int Workload::absorb(Workload &from){
+
+	int offset = ops.size();
+	if(ops.empty())
+		ops.swap(from.ops);
+	else{
+		ops.reserve(ops.size() + from.ops.size());
+		for(unsigned int i = 0; i < from.ops.size(); i++){
+			ops.push_back(std::move(from.ops[i]));
+		}
+		from.ops.clear();
+	}
+	for(unsigned int i = 0; i < from.procs.size(); i++){
+		opSpan span = from.procs[i];
+		span.begin += offset;
+		span.end += offset;
+		procs.push_back(span);
+	}
+	from.procs.clear();
+	open = false;
+	return offset;
+}
+
+// The other workload was parsed as if its text started a file. If a
+// process is still open here its leading operations are the rest of
+// it, up to its A{finish} or the next A{begin} or S, as push would
+// have taken them
+void Workload::extend(Workload &from){
+
+	int offset = ops.size();
+	int lead = 0;
+	bool closed = !open;
+	while(!closed && lead < from.size()){
+		MetaObj &op = from.ops[lead];
+		if(op.getCode() == 'S' || (op.getCode() == 'A' && op.getDesc() == DESC_BEGIN))
+			closed = true;
+		else{
+			lead++;
+			closed = op.getCode() == 'A' && op.getDesc() == DESC_FINISH;
+		}
+	}
+
+	ops.insert(ops.end(), from.ops.begin(), from.ops.end());
+	if(lead > 0)
+		procs.back().end = offset + lead;
+	for(unsigned int proc = 0; proc < from.procs.size(); proc++){
+		opSpan span = from.procs[proc];
+		span.begin += offset;
+		span.end += offset;
+		procs.push_back(span);
+	}
+	open = from.procs.empty() ? !closed : from.open;
+	from.ops.clear();
+	from.procs.clear();
+}
+
+// Each process goes into a workload of its own. Unless all are taken
+// a process still open keeps its operations here, and later pushes
+// carry on with it. Operations outside every span are dropped
+void Workload::split(std::vector<Workload*> &out, bool all){
+
+	unsigned int done = procs.size();
+	if(open && !all)
+		done--;
+	for(unsigned int proc = 0; proc < done; proc++){
+		Workload* one = new Workload;
+		one->take(*this, procs[proc]);
+		out.push_back(one);
+	}
+
+	if(done < procs.size()){
+		opSpan last = procs.back();
+		ops.erase(ops.begin(), ops.begin() + last.begin);
+		last.end -= last.begin;
+		last.begin = 0;
+		procs.assign(1, last);
+	}
+	else{
+		ops.clear();
+		procs.clear();
+		open = false;
+	}
+}
+
+// Spans are walked by where their operations start, so operations
+// only ever move towards the front and keep their order
+void Workload::compact(){
+
+	std::vector<std::pair<int, int>> order;	// Start of each span, then the span
+	for(unsigned int proc = 0; proc < procs.size(); proc++){
+		order.push_back(std::make_pair(procs[proc].begin, proc));
+	}
+	std::sort(order.begin(), order.end());
+
+	int kept = 0;
+	for(unsigned int i = 0; i < order.size(); i++){
+		opSpan &span = procs[order[i].second];
+		int length = span.end - span.begin;
+		std::move(ops.begin() + span.begin, ops.begin() + span.end, ops.begin() + kept);
+		span.begin = kept;
+		span.end = kept + length;
+		kept += length;
+	}
+	ops.resize(kept);
+	open = false;
+}
+
+int Workload::size(){
+	return ops.size();
+}
+
+bool Workload::empty(){
+	return ops.empty();
+}
@@ -0,0 +1,54 @@
+/**
+ * @file	Workload.h
+ * @brief	Definition file for Workload class
+ * @author	Wei Tong
+ * @details Specifies all members of Workload class
+ * @version	1.00
+ * 			Wei Tong (17 October 2026)
+ *			Initial development, keeps parsed operations in one
+ *			array in place of a queue that is copied around
+ */
+
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include "MetaObj.h"
+#include <vector>
+
+// A process's operations, from its A{begin} to its A{finish}
+struct opSpan{
+
+	int begin = 0;
+	int end = 0;		// One past the last operation
+};
+
+// Operations of a meta data file in file order, only ever appended to.
+// Each process is a span of them, scheduling reorders the spans and
+// never moves an operation
+class Workload{
+private:
+	bool open;							// The last span has not reached its A{finish}
+public:
+	std::vector<MetaObj> ops;
+	std::vector<opSpan> procs;			// One span per process, in scheduling order
+
+	// v6.0, set when A{arrival} splits a meta data file, so each part's
+	// processes keep the pids of their places in the file
+	std::vector<int> places;			// Place in the file of each process, before scheduling
+	int file;							// File the part was split from, -1 if it was not
+	int fileProcs;						// Processes in that whole file
+
+	Workload();							// Default constructor, empty
+	~Workload();						// Default deconstructor
+	void push(MetaObj);					// Appends an operation, A{begin} starts a span
+	void take(Workload &, opSpan);		// Appends another workload's process as a new span
+	opSpan append(Workload &, opSpan);	// Same without adding the span, returns it
+	int absorb(Workload &);				// Appends all of another workload, returns where its operations start
+	void extend(Workload &);			// Appends operations parsed from the text after this one's
+	void split(std::vector<Workload*> &, bool);	// Moves out each finished process, or all of them
+	void compact();						// Drops operations outside every span
+	int size();							// Number of operations
+	bool empty();						// True when there are no operations
+};
+
+#endif
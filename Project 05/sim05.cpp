@@ -8,13 +8,25 @@
  * @version	5.0
  * 			Wei Tong (9 May 2018)
  *			This version supports scheduling algorithms
- *			for RR and 
- * @note	Requires ConfData.h, MetaObj.h, PCB.h
+ *			for RR and STR
+ * @note	Requires ConfData.h, MetaObj.h, MdfReader.h, MdfStream.h,
+ *			ProcTable.h, SimClock.h, Timer.h, EventQueue.h,
+ *			ArrivalQueue.h, LoadGen.h, SimState.h, SchPolicy.h,
+ *			SchRegistry.h
  */
 
 #include "ConfData.h"
 #include "MetaObj.h"
-#include "PCB.h"
+#include "MdfReader.h"
+#include "MdfStream.h"
+#include "ProcTable.h"
+#include "SimClock.h"
+#include "Timer.h"
+#include "EventQueue.h"
+#include "ArrivalQueue.h"
+#include "LoadGen.h"
+#include "SimState.h"
+#include "SchRegistry.h"
 #include <queue>
 #include <fstream>
 #include <algorithm>
@@ -22,37 +34,63 @@
 #include <iomanip>
 #include <semaphore.h>
 #include <vector>
+#include <deque>
+#include <map>
 
-#define START 1
-#define READY 2
-#define RUNNING 3
-#define WAITING 4
-#define EXIT 5
+// v6.0, sort key of one process for schAlg
+struct schKey{
 
-int mdfParse(std::string, std::queue<MetaObj> &);
+	int priority = 0;		// A{priority}, PS ranks by it before the key
+	long long key = 0;
+	int proc = 0;			// Process number, counted from 1 in load order
+};
+
+int mdfLoad(std::string, Workload &, int &);
 void confOut(ConfData, std::ostream&, std::ostream&);
-void metaOut(ConfData, std::queue <MetaObj>, std::ostream&, std::ostream&);
+void metaOut(ConfData, Workload &, std::ostream&, std::ostream&);
 
 // v2.0
 unsigned int allocateMem(int, int &, int);
 void waitTime(int);
+void simWait(SimClock*, long long);
 void* timerThreadFunc(void*);
 void* io_sim(void*);
-void procSim(ConfData &, std::queue <MetaObj> &, PCB &, std::ostream&, std::ostream&, int*);
+struct arrivalLoad;
+template<class Policy> void procSim(ConfData &, Workload &, std::vector<arrivalLoad> &, MdfStream*, SimClock &, std::ostream&, std::ostream&, int*);
 
 // v4.0
-void schAlg(std::queue <MetaObj> &, std::string, int *&);
+void schAlg(Workload &, ConfData &, int *&);
+int opTime(ConfData &, MetaObj &);
+long long opKey(simState &, MetaObj &);	// v6.0
+void spendKey(simState &, int, long long, bool);	// v6.0
+bool leastKey(const schKey &, const schKey &);
+bool mostKey(const schKey &, const schKey &);
 
 // v5.0
 void* proc_arrival(void*);
+void* proc_generate(void*);	// v6.0
+
+
+// v6.0, processes that join the simulation at a set time
+struct arrivalLoad{
+
+	long long at = 0;	// Msec after the start the processes arrive at
+	Workload* batch = NULL;	// Operations of the processes
+};
 
 struct new_proc_data{
 
-	std::string file_name;
-	std::queue <MetaObj>* existing_proc_list;
+	std::vector<arrivalLoad>* plan;	// v6.0, in arrival order
+	LoadGen* gen;	// v6.0, makes processes as the simulation runs
+	SimClock* clock;	// v6.0
+	EventQueue* events;	// v6.0, rung when loads are waiting
+	ArrivalQueue* arrivals;	// v6.0, each load is pushed here
 };
 
 
+// v6.0, shared by every thread that calls waitTime
+Timer simTimer;
+
 // Helper to create null output stream
 class nullBuffer : public std::streambuf{
 public:
@@ -61,22 +99,42 @@ public:
 	}
 };
 
-struct timerPackage{
-
-	int countTime = 0;	// Time to count down
-	bool contRun = true;	// Helper to stop thread
-	std::chrono::system_clock::time_point timeEnd;
-};
-
-struct ioPackage{
-
-	int io_time;
-	char io_operation;
-
-	// v3.0
-	sem_t io_sem;
-	pthread_mutex_t io_lock;
-};
+// v6.0
+void logTime(long long, std::ostream&, std::ostream&);
+void logEvent(simState &, long long, std::string);
+void logProcess(simState &, int, long long, std::string);
+void startTimer(timerPackage &, int, SimEvent);
+void startCPU(simState &, int, int);
+void requestIO(simState &, int);
+void startIO(simState &, int, int, int);
+void coreReport(simState &, long long);
+void loadReport(simState &, LoadGen &, long long);
+void scheduleGenerated(simState &, LoadGen &);
+void cancelTimer(timerPackage &);
+int addProcesses(simState &, Workload &, int*);
+int takePids(simState &, Workload &);
+void loadProcess(simState &, int);
+void releaseProcess(simState &, int);
+void setAttribute(simProcess &, MetaObj &);
+
+// v6.0, the parts of the simulator loop that depend on the scheduling
+// policy, built once for each policy in SchRegistry.h
+template<class Policy> void startSlice(simState &, Policy &, int);
+template<class Policy> void stepProcess(simState &, Policy &, int);
+template<class Policy> void finishCPU(simState &, Policy &, SimEvent);
+template<class Policy> void finishIO(simState &, Policy &, SimEvent);
+template<class Policy> void makeReady(simState &, Policy &, int, int);
+template<class Policy> bool preemptCore(simState &, Policy &, int);
+template<class Policy> void admitArrival(simState &, Policy &, Workload*);
+template<class Policy> void admitStream(simState &, Policy &);
+template<class Policy> int takeReady(simState &, Policy &, int, bool);
+template<class Policy> bool dispatchIdle(simState &, Policy &);
+bool schKnown(std::string);
+bool schStreams(std::string);
+void runPolicy(ConfData &, Workload &, std::vector<arrivalLoad> &, MdfStream*, SimClock &, std::ostream&, std::ostream&, int*);
+void splitArrivals(Workload &, int, long long, std::vector<arrivalLoad> &);
+bool planArrivals(ConfData &, std::vector<arrivalLoad> &);
+bool earlierLoad(const arrivalLoad &, const arrivalLoad &);
 
 int main(int argc, char *argv[]){
 
@@ -87,7 +145,7 @@ int main(int argc, char *argv[]){
 	}
 
 	ConfData cfgd;
-	std::queue <MetaObj> mdq;
+	Workload mdq;
 	std::ifstream fin;
 	std::ofstream fout;
 	std::string cfgFile = argv[1], temp, mdDesc, errorMsg;
@@ -136,39 +194,48 @@ int main(int argc, char *argv[]){
 	if(!cfgd.readStatus())
 		return 0;
 
+	// v6.0
+	if(!schKnown(cfgd.get_sch())){
+		std::cout << "Error: unknown scheduling algorithm " << cfgd.get_sch() << std::endl;
+		return 0;
+	}
+
 	temp = cfgd.getFilePath();
 	if(temp.substr(temp.length() - 4) != ".mdf"){
 		std::cout << "Error: meta data file should have .mdf extension" << std::endl;
 		return 0;
 	}
 
-	fin.open(cfgd.getFilePath());
-	if(!fin.is_open()){
-		std::cout << "Error: meta data file not found" << std::endl;
+	// v6.0, with a stream window the meta data file is read while the
+	// simulation runs, only the first line is checked here
+	MdfStream stream;
+	bool streaming = cfgd.get_stream_window() > 0;
+	if(streaming && !schStreams(cfgd.get_sch())){
+		std::cout << "Error: " << cfgd.get_sch() << " needs the whole meta data file, stream it with FIFO, RR, STR or SJF" << std::endl;
+		return 0;
+	}
+	if(streaming && cfgd.get_load_procs() > 0){
+		std::cout << "Error: the load generator reports on every process, it cannot run with a meta data stream" << std::endl;
 		return 0;
 	}
 
-	if(!getline(fin, temp)){
+	// Read in meta data file to the workload
+	if(streaming)
+		readStatus = stream.open(cfgd.getFilePath(), cfgd.get_stream_window());
+	else
+		readStatus = mdfLoad(cfgd.getFilePath(), mdq, lineCounter);
+	if(readStatus == 5){
+		std::cout << "Error: meta data file not found" << std::endl;
+		return 0;
+	}
+	if(readStatus == 6){
 		std::cout << "Error: empty meta data file" << std::endl;
 		return 0;
 	}
-
-	if(temp.compare("Start Program Meta-Data Code:")){
+	if(readStatus == 7){
 		std::cout << "Error: bad start of meta data file" << std::endl;
 		return 0;
 	}
-
-	// Read in meta data file to queue
-	lineCounter = 1, readStatus = 0;
-	while(!readStatus){
-		if(!getline(fin, temp) || !temp.compare("End Program Meta-Data Code."))
-			readStatus = 4;	// Done reading
-		else
-			readStatus = mdfParse(temp, mdq);
-		lineCounter++;
-	}
-	fin.close();
-
 	if(readStatus == 1){
 		std::cout << "Code error in line " << lineCounter << " of the meta data file" << std::endl;
 		return 0;
@@ -213,20 +280,31 @@ int main(int argc, char *argv[]){
 	}
 	*/
 
+	// v6.0, processes with an A{arrival} and every other load of
+	// processes are held back until their time in the simulation
+	std::vector<arrivalLoad> plan;
+	splitArrivals(mdq, 0, 0, plan);
+	if(!planArrivals(cfgd, plan))
+		return 0;
+	if(streaming)
+		stream.start();
+
 	// Schedule algorithm
 	int* procList;
-	schAlg(mdq, cfgd.get_sch(), procList);
+	schAlg(mdq, cfgd, procList);
 
 	// Simulate process
-	PCB procState;
-
-	// v5.0, simulate process arrival
-	new_proc_data newProcData;
-	newProcData.file_name = cfgFile;
-	newProcData.existing_proc_list = &mdq;
-
-	pthread_t add_proc;
-	pthread_create(&add_proc, NULL, proc_arrival, (void *) &newProcData);
+	// v6.0, wall clock or virtual clock
+	SimClock simClock;
+	simClock.setVirtual(cfgd.get_clock() == "Virtual");
+	simClock.setSpeed(cfgd.get_speed());
+	if(cfgd.get_timer() == "Spin")
+		simTimer.setMode(TIMER_SPIN);
+	else if(cfgd.get_timer() == "Sleep")
+		simTimer.setMode(TIMER_SLEEP);
+	else
+		simTimer.setMode(TIMER_HYBRID);
+	simTimer.setSpinTail(cfgd.get_spin_tail());
 
 	if(cfgd.getLogLvl() == 1){
 
@@ -234,7 +312,7 @@ int main(int argc, char *argv[]){
 		std::ostream null_stream(&nb);
 
 		// Log to monitor
-		procSim(cfgd, mdq, procState, std::cout, null_stream, procList);
+		runPolicy(cfgd, mdq, plan, streaming ? &stream : NULL, simClock, std::cout, null_stream, procList);
 	}
 	else if(cfgd.getLogLvl() == 2){
 
@@ -244,67 +322,29 @@ int main(int argc, char *argv[]){
 		// Log to file
 		std::ofstream fout;
 		fout.open(cfgd.getLogPath(), std::fstream::out);
-		procSim(cfgd, mdq, procState, fout, null_stream, procList);
+		runPolicy(cfgd, mdq, plan, streaming ? &stream : NULL, simClock, fout, null_stream, procList);
 	}
 	else{
 
 		// Log to both
 		std::ofstream fout;
 		fout.open(cfgd.getLogPath(), std::fstream::out);
-		procSim(cfgd, mdq, procState, std::cout, fout, procList);
+		runPolicy(cfgd, mdq, plan, streaming ? &stream : NULL, simClock, std::cout, fout, procList);
 	}
 
-	pthread_join(add_proc, NULL);
-
 	return 0;
 }
 
-// This function will parse the line of input and put the
-// data into the queue of MetaObj.
-int mdfParse(std::string inputStr, std::queue<MetaObj> &inQ){
-
-	char code;
-	std::string description, tempStr;
-	int cycles;
-
-	// Erase any beginning white spaces
-	inputStr.erase(remove_if(inputStr.begin(), inputStr.end(), ::isblank), inputStr.end());
-
-	while(inputStr.compare("")){
+// v6.0, reads a whole meta data file into the workload. Returns 0 when
+// done, the parse error with lineCounter at the bad line, 5 if the
+// file is missing, 6 if it is empty or 7 if it starts wrong
+int mdfLoad(std::string fileName, Workload &inQ, int &lineCounter){
 
-		// Parsing the first set of instructions
-		code = inputStr[0];
-		description = inputStr.substr(inputStr.find_first_of("{") + 1, inputStr.find_first_of("}") - 2);
-		tempStr = inputStr.substr(inputStr.find_first_of("}") + 1, inputStr.find_first_of(";.") - inputStr.find_first_of("}"));
-		std::stringstream str2Num(tempStr);
-		str2Num >> cycles;
-		if(!str2Num){
-			return 3;
-		}
-		inputStr = inputStr.substr(inputStr.find_first_of(";.") + 1);
-
-		// Putting the parsed data into the queue
-		// Parameterized constructer NOT used because
-		// input is not guaranteed to be correct
-		MetaObj newMD;
-		if(newMD.setCode(code)){
-			if(newMD.setDescription(description)){
-				if(!newMD.setCycles(cycles)){
-					return 3;
-				}
-			}
-			else{
-				return 2;
-			}
-		}
-		else{
-			return 1;
-		}
-
-		// Push into the queue
-		inQ.push(newMD);
-	}
-	return 0;
+	MdfReader reader;
+	int readStatus = reader.open(fileName);
+	if(readStatus)
+		return readStatus;
+	return reader.load(inQ, lineCounter);
 }
 
 void confOut(ConfData confOutput, std::ostream& out1, std::ostream& out2){
@@ -332,7 +372,7 @@ void confOut(ConfData confOutput, std::ostream& out1, std::ostream& out2){
 	out2 << std::endl << "Meta-Data Metrics" << std::endl;
 }
 
-void metaOut(ConfData confNums, std::queue <MetaObj> dataQ, std::ostream& out1, std::ostream& out2){
+void metaOut(ConfData confNums, Workload &dataQ, std::ostream& out1, std::ostream& out2){
 
 	int monT = confNums.getCycleTime("Monitor");
 	int procT = confNums.getCycleTime("Processor");
@@ -342,46 +382,40 @@ void metaOut(ConfData confNums, std::queue <MetaObj> dataQ, std::ostream& out1,
 	int memT = confNums.getCycleTime("Memory");
 	int projT = confNums.getCycleTime("Projector");
 
-	MetaObj temp;
-	while(!dataQ.empty()){
-		temp = dataQ.front();
+	for(int i = 0; i < dataQ.size(); i++){
+		MetaObj &temp = dataQ.ops[i];
 
-		// Ignore begin and finish commands
-		if(temp.getDescription() != "begin" && temp.getDescription() != "finish"){
+		// Ignore begin and finish commands, and process attributes
+		if(temp.getCode() != 'A' && temp.getCode() != 'S'){
 			out1 << temp.getCode() << "{" << temp.getDescription() << "}" << temp.getCycles() << " - ";
 			out2 << temp.getCode() << "{" << temp.getDescription() << "}" << temp.getCycles() << " - ";
-			if(temp.getDescription() == "monitor"){
-				out1 << monT * temp.getCycles() << " ms" << std::endl;
-				out2 << monT * temp.getCycles() << " ms" << std::endl;
-			}
-			else if(temp.getDescription() == "run"){
-				out1 << procT * temp.getCycles() << " ms" << std::endl;
-				out2 << procT * temp.getCycles() << " ms" << std::endl;
-			}
-			else if(temp.getDescription() == "scanner"){
-				out1 << scanT * temp.getCycles() << " ms" << std::endl;
-				out2 << scanT * temp.getCycles() << " ms" << std::endl;
-			}
-			else if(temp.getDescription() == "hard drive"){
-				out1 << hdT * temp.getCycles() << " ms" << std::endl;
-				out2 << hdT * temp.getCycles() << " ms" << std::endl;
-			}
-			else if(temp.getDescription() == "keyboard"){
-				out1 << keyT * temp.getCycles() << " ms" << std::endl;
-				out2 << keyT * temp.getCycles() << " ms" << std::endl;
-			}
-			else if(temp.getDescription() == "projector"){
-				out1 << projT * temp.getCycles() << " ms" << std::endl;
-				out2 << projT * temp.getCycles() << " ms" << std::endl;
-			}
-			else{
-				out1 << memT * temp.getCycles() << " ms" << std::endl;
-				out2 << memT * temp.getCycles() << " ms" << std::endl;
+			int cycleT;
+			switch(temp.getDesc()){
+			case DESC_MONITOR:
+				cycleT = monT;
+				break;
+			case DESC_RUN:
+				cycleT = procT;
+				break;
+			case DESC_SCANNER:
+				cycleT = scanT;
+				break;
+			case DESC_HARD_DRIVE:
+				cycleT = hdT;
+				break;
+			case DESC_KEYBOARD:
+				cycleT = keyT;
+				break;
+			case DESC_PROJECTOR:
+				cycleT = projT;
+				break;
+			default:
 				// This takes care of allocate and block, which are both considered Memory
-				// Unfortunately takes care of anything else. Might consider fixing in future if needed
+				cycleT = memT;
 			}
+			out1 << cycleT * temp.getCycles() << " ms" << std::endl;
+			out2 << cycleT * temp.getCycles() << " ms" << std::endl;
 		}
-		dataQ.pop();
 	}
 }
 
@@ -403,39 +437,52 @@ unsigned int allocateMem(int maxMem, int &last_addr, int block_size){
 	}
 }
 
+// v6.0, sleeps instead of spinning for the whole wait,
+// accuracy vs CPU is chosen by the Timer Mode config
 void waitTime(int msec){
 
-	auto start = std::chrono::system_clock::now();
-	bool sleep = true;
-	auto now = std::chrono::system_clock::now();
-	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
-	while(sleep){
-		now = std::chrono::system_clock::now();
-		elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
-		if(elapsed.count() >= msec){
-			sleep = false;
-		}
-	}
+	simTimer.waitFor((long long)msec * 1000);
 }
 
+// v6.0, waits for msec of simulated time, shortened
+// by the Simulation speed multiplier
+void simWait(SimClock* clock, long long msec){
+
+	simTimer.waitFor(clock->realTime(msec));
+}
+
+// v6.0, sleeps until a count down is requested, waits it out in a
+// single timed wait and posts the finished event the moment it is over
+// or the moment it is cancelled
 void* timerThreadFunc(void* castedPackage){
 
 	timerPackage *p2 = (struct timerPackage*)castedPackage;
-	while(p2->contRun){
-
-		// Counting down every millisecond
-		if(p2->countTime > 0){
-			waitTime(1);
-			p2->countTime--;
-		}
 
-		// Finished counting down, marking time
-		else if(p2->countTime == 0){
-			p2->timeEnd = std::chrono::system_clock::now();
-			p2->countTime--;
+	pthread_mutex_lock(&p2->timer_lock);
+	while(true){
+		while(!p2->pending && p2->contRun){
+			pthread_cond_wait(&p2->timer_request, &p2->timer_lock);
 		}
-		p2 = (struct timerPackage*)castedPackage;
+		if(!p2->contRun)
+			break;
+		p2->pending = false;
+		p2->active = true;
+		int msec = p2->countTime;
+		SimEvent finished = p2->finished;
+
+		// Preemption sets cancel and cuts the wait short, the finished
+		// event is still posted and the engine drops it as stale
+		timespec deadline = simTimer.after(p2->clock->realTime(msec));
+		simTimer.waitUntil(deadline, &p2->timer_lock, &p2->timer_request, &p2->cancel);
+		p2->cancel = false;
+		p2->active = false;
+		pthread_mutex_unlock(&p2->timer_lock);
+
+		p2->events->post(finished);
+
+		pthread_mutex_lock(&p2->timer_lock);
 	}
+	pthread_mutex_unlock(&p2->timer_lock);
 
 	// Return statement required to remove compiler warning
 	// However, it is not technically required
@@ -447,470 +494,1178 @@ void* io_sim(void* casted_io){
 	ioPackage* op_info = (struct ioPackage*)casted_io;
 
 	// Semaphore lock
-	sem_wait(&op_info->io_sem);
+	if(op_info->io_sem != NULL)
+		sem_wait(op_info->io_sem);
 
 	// Mutex Lock
-	pthread_mutex_lock(&op_info->io_lock);
+	if(op_info->io_lock != NULL)
+		pthread_mutex_lock(op_info->io_lock);
 
-	waitTime(op_info->io_time);
+	simWait(op_info->clock, op_info->io_time);
 
 	// Mutex Unlock
-	pthread_mutex_unlock(&op_info->io_lock);
+	if(op_info->io_lock != NULL)
+		pthread_mutex_unlock(op_info->io_lock);
+
+	// Semaphore release
+	if(op_info->io_sem != NULL)
+		sem_post(op_info->io_sem);
+
+	// v6.0, wake the simulator, the package is freed by it after this
+	op_info->events->post(op_info->finished);
 
 	return casted_io;
 }
 
-void procSim(ConfData &timeConf, std::queue <MetaObj> &procInfo, PCB &controlBlock, std::ostream& out1, std::ostream& out2, int* org_procList){
-
-	int monT = timeConf.getCycleTime("Monitor");
-	int procT = timeConf.getCycleTime("Processor");
-	int scanT = timeConf.getCycleTime("Scanner");
-	int hdT = timeConf.getCycleTime("Hard Drive");
-	int keyT = timeConf.getCycleTime("Keyboard");
-	int memT = timeConf.getCycleTime("Memory");
-	int projT = timeConf.getCycleTime("Projector");
-
-	timerPackage p1;
-	pthread_t original_thread, io_tracker;
-	// int procNum = 0;	// Keep track of the process ID/number
-	int procCounter = -1; // Keep track of process ID/number
-
-	// New thread dedicated towards timing
-	pthread_create(&original_thread, NULL, timerThreadFunc, (void *) &p1);
-
-	auto refPoint = std::chrono::system_clock::now();
-	auto rightNow = std::chrono::system_clock::now();
-	MetaObj temp;
-
-	int max_mem = timeConf.getMem();
-	int last_mem_addr = -1;
-	int mem_block = timeConf.getMemBlock();
-	int last_hdd = -1;
-	int num_hdd = timeConf.getNumHDD();
-	int last_proj = -1;
-	int num_proj = timeConf.getNumProj();
-
-	while(!procInfo.empty()){
-		temp = procInfo.front();
-		rightNow = std::chrono::system_clock::now();
-		out1 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-		out2 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-
-		if(temp.getCode() == 'S'){
-			if(temp.getDescription() == "begin"){
-				out1 << " - Simulator program starting" << std::endl;
-				out2 << " - Simulator program starting" << std::endl;
-			}
-			else{
-				out1 << " - Simulator program ending" << std::endl;
-				out2 << " - Simulator program ending" << std::endl;
+// v6.0
+// Prints a simulated time stamp (microseconds) in seconds
+void logTime(long long simTime, std::ostream& out1, std::ostream& out2){
+
+	out1 << std::fixed << std::setprecision(6) << simTime / (double)1000000;
+	out2 << std::fixed << std::setprecision(6) << simTime / (double)1000000;
+}
+
+// Prints one line of the simulation log. Threads stamp their events
+// before they queue them, so keep the log in order on the real clock
+void logEvent(simState &sim, long long simTime, std::string msg){
+
+	if(simTime < sim.lastLogged)
+		simTime = sim.lastLogged;
+	sim.lastLogged = simTime;
+	logTime(simTime, *sim.out1, *sim.out2);
+	*sim.out1 << " - " << msg << std::endl;
+	*sim.out2 << " - " << msg << std::endl;
+}
+
+// Prints a log line for a process, tagged with its core when
+// the simulation has more than one
+void logProcess(simState &sim, int proc, long long simTime, std::string msg){
+
+	if(sim.cores.size() > 1)
+		msg = "[core " + std::to_string(sim.procs[proc].core) + "] " + msg;
+	logEvent(sim, simTime, msg);
+}
+
+// Hands a count down to the timer thread without waiting for it
+void startTimer(timerPackage &p1, int msec, SimEvent finished){
+
+	pthread_mutex_lock(&p1.timer_lock);
+	p1.countTime = msec;
+	p1.finished = finished;
+	p1.pending = true;
+	pthread_cond_signal(&p1.timer_request);
+	pthread_mutex_unlock(&p1.timer_lock);
+}
+
+// Stops the timer of a preempted slice. A count down the timer thread
+// has not picked up yet is dropped, its finished event posted right away
+void cancelTimer(timerPackage &p1){
+
+	pthread_mutex_lock(&p1.timer_lock);
+	if(p1.pending){
+		p1.pending = false;
+		p1.events->post(p1.finished);
+	}
+	else if(p1.active){
+		p1.cancel = true;
+		pthread_cond_signal(&p1.timer_request);
+	}
+	pthread_mutex_unlock(&p1.timer_lock);
+}
+
+// Puts a processor or memory operation on the processor. The virtual
+// clock schedules its end, the real clock lets the timer thread post it
+void startCPU(simState &sim, int proc, int msec){
+
+	coreState &core = sim.cores[sim.procs[proc].core];
+	SimEvent finished;
+	finished.type = EV_CPU_DONE;
+	finished.proc = proc;
+	finished.core = sim.procs[proc].core;
+	finished.token = ++sim.procs[proc].sliceToken;
+	core.busySince = sim.clock->now();
+
+	if(sim.clock->isVirtual()){
+		sim.events->schedule(finished, msec);
+	}
+	else{
+		sim.events->expect();
+		startTimer(core.timer, msec, finished);
+	}
+}
+
+// Runs the processing action at the front of the process for one
+// slice, no longer than the policy's quantum
+template<class Policy>
+void startSlice(simState &sim, Policy &policy, int proc){
+
+	simProcess &current = sim.procs[proc];
+	int quantum = policy.quantum(sim, proc);
+	current.sliceLen = sim.table.opLeft[proc];
+	if(quantum > 0 && current.sliceLen > quantum)
+		current.sliceLen = quantum;
+	startCPU(sim, proc, current.sliceLen);
+}
+
+// Runs the process on the processor until it starts an operation
+// that takes time, blocks on I/O or is removed
+template<class Policy>
+void stepProcess(simState &sim, Policy &policy, int proc){
+
+	simProcess &current = sim.procs[proc];
+	ProcTable &table = sim.table;
+	std::string pid = std::to_string(table.pid[proc]);
+	long long now = sim.clock->now();
+
+	while(!opsDone(sim, proc)){
+		MetaObj &temp = currentOp(sim, proc);
+
+		if(temp.getCode() == 'A'){
+			if(temp.getDesc() == DESC_BEGIN){
+				table.started[proc] = now;
+				table.setState(proc, START, now);
+				logProcess(sim, proc, now, "OS: preparing process " + pid);
+				table.setState(proc, READY, now);
+				logProcess(sim, proc, now, "OS: starting process " + pid);
+				table.setState(proc, RUNNING, now);
+				table.pc[proc]++;
 			}
-		}
-		else if(temp.getCode() == 'A'){
-			if(temp.getDescription() == "begin"){
-				controlBlock.setState(START);
-				procCounter++;
-				out1 << " - OS: preparing process " << org_procList[procCounter] << std::endl;
-				out2 << " - OS: preparing process " << org_procList[procCounter] << std::endl;
-				controlBlock.setState(READY);
-
-				/*
-				PCB will have to be overhauled in order to support multi-processes.
-				Current implementation (v2.0) tracks process ID/number, but does not support
-				multiple processes.
-				*/
-
-				rightNow = std::chrono::system_clock::now();
-				out1 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-				out2 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-				out1 << " - OS: starting process " << org_procList[procCounter] << std::endl;
-				out2 << " - OS: starting process " << org_procList[procCounter] << std::endl;
-				controlBlock.setState(RUNNING);
+			else if(temp.getDesc() == DESC_FINISH){
+				logProcess(sim, proc, now, "OS: removing process " + pid);
+				table.pc[proc]++;
+				break;
 			}
 			else{
-				out1 << " - OS: removing process " << org_procList[procCounter] << std::endl;
-				out2 << " - OS: removing process " << org_procList[procCounter] << std::endl;
-				controlBlock.setState(EXIT);
+				table.pc[proc]++;	// Attributes were applied when the process was added
 			}
 		}
 		else if(temp.getCode() == 'P'){
-			out1 << " - Process " << org_procList[procCounter] << ": start processing action" << std::endl;
-			out2 << " - Process " << org_procList[procCounter] << ": start processing action" << std::endl;
-			p1.countTime = procT * temp.getCycles();
-			while(p1.countTime >= 0){
-				waitTime(100);	// Check only every 100ms
-			}
-			out1 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(p1.timeEnd - refPoint).count() / (double)1000000;
-			out2 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(p1.timeEnd - refPoint).count() / (double)1000000;
-			out1 << " - Process " << org_procList[procCounter] << ": end processing action" << std::endl;
-			out2 << " - Process " << org_procList[procCounter] << ": end processing action" << std::endl;
+			logProcess(sim, proc, now, "Process " + pid + ": start processing action");
+			if(table.opLeft[proc] < 0)
+				table.opLeft[proc] = sim.procT * temp.getCycles();
+			startSlice(sim, policy, proc);
+			return;
 		}
 		else if(temp.getCode() == 'M'){
-			if(temp.getDescription() == "allocate"){
-				out1 << " - Process " << org_procList[procCounter] << ": allocating memory" << std::endl;
-				out2 << " - Process " << org_procList[procCounter] << ": allocating memory" << std::endl;
-				p1.countTime = memT * temp.getCycles();
-				while(p1.countTime >= 0){
-					waitTime(100);
-				}
-
-				int memAddr = allocateMem(max_mem, last_mem_addr, mem_block);
-
-				out1 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(p1.timeEnd - refPoint).count() / (double)1000000;
-				out2 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(p1.timeEnd - refPoint).count() / (double)1000000;
-				out1 << " - Process " << org_procList[procCounter] << ": memory allocated at " <<  "0x" << std::hex << std::setw(8) << std::setfill('0') << memAddr << std::endl;
-				out2 << " - Process " << org_procList[procCounter] << ": memory allocated at " <<  "0x" << std::hex << std::setw(8) << std::setfill('0') << memAddr << std::endl;
-			}
-			else{
-				out1 << " - Process " << org_procList[procCounter] << ": start memory blocking" << std::endl;
-				out2 << " - Process " << org_procList[procCounter] << ": start memory blocking" << std::endl;
-				p1.countTime = memT * temp.getCycles();
-				while(p1.countTime >= 0){
-					waitTime(100);
-				}
-
-				rightNow = std::chrono::system_clock::now();
-				out1 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-				out2 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-				out1 << " - Process " << org_procList[procCounter] << ": end memory blocking" << std::endl;
-				out2 << " - Process " << org_procList[procCounter] << ": end memory blocking" << std::endl;
-			}
-		}
-		else if(temp.getCode() == 'I'){
-			out1 << " - Process " << org_procList[procCounter] << ": start " << temp.getDescription() << " input";
-			out2 << " - Process " << org_procList[procCounter] << ": start " << temp.getDescription() << " input";
-			ioPackage op_data;
-			if(temp.getDescription() == "hard drive"){
-				if(last_hdd == -1 || last_hdd + 1 >= num_hdd){
-					out1 << " on HDD 0" << std::endl;
-					out2 << " on HDD 0" << std::endl;
-					last_hdd = 0;
-				}
-				else{
-					last_hdd++;
-					out1 << " on HDD " << last_hdd << std::endl;
-					out2 << " on HDD " << last_hdd << std::endl;
-				}
-				op_data.io_time = hdT * temp.getCycles();
-			}
-			else if(temp.getDescription() == "keyboard"){
-				out1 << std::endl;
-				out2 << std::endl;
-				op_data.io_time = keyT * temp.getCycles();
-			}
-			else{
-				out1 << std::endl;
-				out2 << std::endl;
-				op_data.io_time = scanT * temp.getCycles();
-			}
-			op_data.io_operation = 'I';
-			sem_init(&op_data.io_sem, 0, 1);
-			
-			pthread_mutex_init(&op_data.io_lock, NULL);
-
-			controlBlock.setState(WAITING);
-			pthread_create(&io_tracker, NULL, io_sim, (void *) &op_data);
-			pthread_join(io_tracker, NULL);
-			pthread_mutex_destroy(&op_data.io_lock);	// Mutex destruction
-			sem_post(&op_data.io_sem);	// Semaphore release
-			controlBlock.setState(RUNNING);
-			
-			rightNow = std::chrono::system_clock::now();
-			out1 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-			out2 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-			out1 << " - Process " << org_procList[procCounter] << ": end " << temp.getDescription() << " input" << std::endl;
-			out2 << " - Process " << org_procList[procCounter] << ": end " << temp.getDescription() << " input" << std::endl;
-		}
-		else if(temp.getCode() == 'O'){
-			out1 << " - Process " << org_procList[procCounter] << ": start " << temp.getDescription() << " output";
-			out2 << " - Process " << org_procList[procCounter] << ": start " << temp.getDescription() << " output";
-			ioPackage op_data;
-			if(temp.getDescription() == "hard drive"){
-				if(last_hdd == -1 || last_hdd + 1 >= num_hdd){
-					out1 << " on HDD 0" << std::endl;
-					out2 << " on HDD 0" << std::endl;
-					last_hdd = 0;
-				}
-				else{
-					last_hdd++;
-					out1 << " on HDD " << last_hdd << std::endl;
-					out2 << " on HDD " << last_hdd << std::endl;
-				}
-				op_data.io_time = hdT * temp.getCycles();
-			}
-			else if(temp.getDescription() == "monitor"){
-				out1 << std::endl;
-				out2 << std::endl;
-				op_data.io_time = monT * temp.getCycles();
-			}
-			else{
-				if(last_proj == -1 || last_proj + 1 >= num_proj){
-					out1 << " on PROJ 0" << std::endl;
-					out2 << " on PROJ 0" << std::endl;
-					last_proj = 0;
-				}
-				else{
-					last_proj++;
-					out1 << " on PROJ " << last_proj << std::endl;
-					out2 << " on PROJ " << last_proj << std::endl;
-				}
-				op_data.io_time = projT * temp.getCycles();
-			}
-			op_data.io_operation = 'O';
-			sem_init(&op_data.io_sem, 0, 1);
-			
-			pthread_mutex_init(&op_data.io_lock, NULL);
-			
-			controlBlock.setState(WAITING);
-			pthread_create(&io_tracker, NULL, io_sim, (void *) &op_data);
-			pthread_join(io_tracker, NULL);
-			pthread_mutex_destroy(&op_data.io_lock);	// Mutex destruction
-			sem_post(&op_data.io_sem);	// Semaphore release
-			pthread_mutex_destroy(&op_data.io_lock);
-			controlBlock.setState(RUNNING);
-			
-			rightNow = std::chrono::system_clock::now();
-			out1 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-			out2 << std::fixed << std::setprecision(6) << std::chrono::duration_cast<std::chrono::microseconds>(rightNow - refPoint).count() / (double)1000000;
-			out1 << " - Process " << org_procList[procCounter] << ": end " << temp.getDescription() << " output" << std::endl;
-			out2 << " - Process " << org_procList[procCounter] << ": end " << temp.getDescription() << " output" << std::endl;
-		}
-
-		procInfo.pop();
-	}
-
-	p1.contRun = false;	// Alert timer thread to stop, since process is ending
-	pthread_join(original_thread, NULL);
-}
-
-void schAlg(std::queue <MetaObj> &procList, std::string schType, int *&procOrganized){
-
-	std::queue <MetaObj> q_temp_1, q_temp_2;
-	int procNum = 0;
-	while(!procList.empty()){
-		if(procList.front().getCode() != 'A'){
-			q_temp_1.push(procList.front());
-			procList.pop();
+			if(temp.getDesc() == DESC_ALLOCATE)
+				logProcess(sim, proc, now, "Process " + pid + ": allocating memory");
+			else
+				logProcess(sim, proc, now, "Process " + pid + ": start memory blocking");
+			startCPU(sim, proc, sim.memT * temp.getCycles());
+			return;
 		}
 		else{
-			if(procList.front().getDescription() == "begin"){
-				procNum++;
+			// I/O gives up the processor until it finishes
+			table.setState(proc, WAITING, now);
+			sim.cores[current.core].running = -1;
+			requestIO(sim, proc);
+			return;
+		}
+	}
+
+	// Process is done, free the processor
+	table.setState(proc, EXIT, now);
+	table.removed[proc] = now;
+	sim.finished++;
+	policy.onExit(sim, proc);
+	sim.cores[current.core].running = -1;
+	if(current.streamed)
+		releaseProcess(sim, proc);
+}
+
+// Starts the I/O operation at the front of the process, or queues
+// it behind the others if every unit of its device is in use
+void requestIO(simState &sim, int proc){
+
+	metaDesc desc = currentOp(sim, proc).getDesc();
+	int dev = -1;
+	if(desc == DESC_HARD_DRIVE)
+		dev = DEV_HDD;
+	else if(desc == DESC_PROJECTOR)
+		dev = DEV_PROJ;
+
+	if(dev == -1){
+		startIO(sim, proc, -1, -1);
+		return;
+	}
+
+	devicePool &pool = sim.devices[dev];
+	int units = pool.busy.size();
+	for(int i = 1; i <= units; i++){
+		int unit = (pool.last + i) % units;
+		if(!pool.busy[unit]){
+			pool.busy[unit] = true;
+			pool.last = unit;
+			startIO(sim, proc, dev, unit);
+			return;
+		}
+	}
+	pool.waiting.push(proc);
+}
+
+void startIO(simState &sim, int proc, int dev, int unit){
+
+	simProcess &current = sim.procs[proc];
+	MetaObj &temp = currentOp(sim, proc);
+	std::string msg = "Process " + std::to_string(sim.table.pid[proc]) + ": start " + temp.getDescription();
+	msg += (temp.getCode() == 'I') ? " input" : " output";
+	if(dev != -1)
+		msg += " on " + sim.devices[dev].name + " " + std::to_string(unit);
+	logProcess(sim, proc, sim.clock->now(), msg);
+
+	int io_time;
+	switch(temp.getDesc()){
+	case DESC_HARD_DRIVE:
+		io_time = sim.hdT * temp.getCycles();
+		break;
+	case DESC_KEYBOARD:
+		io_time = sim.keyT * temp.getCycles();
+		break;
+	case DESC_SCANNER:
+		io_time = sim.scanT * temp.getCycles();
+		break;
+	case DESC_MONITOR:
+		io_time = sim.monT * temp.getCycles();
+		break;
+	default:
+		io_time = sim.projT * temp.getCycles();
+	}
+
+	sim.table.device[proc] = dev;
+	sim.table.unit[proc] = unit;
+
+	SimEvent finished;
+	finished.type = EV_IO_DONE;
+	finished.proc = proc;
+	finished.device = dev;
+	finished.unit = unit;
+
+	if(sim.clock->isVirtual()){
+		sim.events->schedule(finished, io_time);
+		return;
+	}
+
+	ioPackage* op_data = new ioPackage;
+	op_data->io_time = io_time;
+	op_data->io_operation = temp.getCode();
+	op_data->io_sem = (dev != -1) ? &sim.devices[dev].free_units : NULL;
+	op_data->io_lock = (dev != -1) ? &sim.devices[dev].unit_lock[unit] : NULL;
+	op_data->clock = sim.clock;
+	op_data->events = sim.events;
+	op_data->finished = finished;
+
+	current.io_data = op_data;
+	sim.events->expect();
+	pthread_create(&current.io_thread, NULL, io_sim, (void *) op_data);
+}
+
+template<class Policy>
+void finishCPU(simState &sim, Policy &policy, SimEvent done){
+
+	simProcess &current = sim.procs[done.proc];
+
+	// The slice was preempted, its time is already accounted for
+	if(done.token != current.sliceToken)
+		return;
+
+	ProcTable &table = sim.table;
+	MetaObj &temp = currentOp(sim, done.proc);
+	std::string pid = std::to_string(table.pid[done.proc]);
+	sim.cores[done.core].busy += done.time - sim.cores[done.core].busySince;
+
+	if(temp.getCode() == 'P'){
+		table.opLeft[done.proc] -= current.sliceLen;
+		table.workLeft[done.proc] -= current.sliceLen;
+		spendKey(sim, done.proc, current.sliceLen, table.opLeft[done.proc] <= 0);
+		policy.charge(sim, done.proc, current.sliceLen);
+		if(table.opLeft[done.proc] > 0){
+
+			// Nobody is waiting for the core, carry on for another quantum
+			if(policy.waiting(current.core) == 0){
+				startSlice(sim, policy, done.proc);
+				return;
 			}
-			q_temp_1.push(procList.front());
-			procList.pop();
+
+			// Quantum expired, back of the line
+			logProcess(sim, done.proc, done.time, "Process " + pid + ": interrupt processing action");
+			sim.preemptions++;
+			table.setState(done.proc, READY, sim.clock->now());
+			sim.cores[current.core].running = -1;
+			policy.enqueue(sim, current.core, done.proc);
+			return;
 		}
+		table.opLeft[done.proc] = -1;
+		logProcess(sim, done.proc, done.time, "Process " + pid + ": end processing action");
+	}
+	else if(temp.getDesc() == DESC_ALLOCATE){
+		table.workLeft[done.proc] -= sim.memT * temp.getCycles();
+		spendKey(sim, done.proc, sim.memT * temp.getCycles(), true);
+		table.memBlocks[done.proc]++;
+		policy.charge(sim, done.proc, sim.memT * temp.getCycles());
+		std::ostringstream memAddr;
+		memAddr << "0x" << std::hex << std::setw(8) << std::setfill('0') << allocateMem(sim.max_mem, sim.last_mem_addr, sim.mem_block);
+		logProcess(sim, done.proc, done.time, "Process " + pid + ": memory allocated at " + memAddr.str());
+	}
+	else{
+		table.workLeft[done.proc] -= sim.memT * temp.getCycles();
+		spendKey(sim, done.proc, sim.memT * temp.getCycles(), true);
+		policy.charge(sim, done.proc, sim.memT * temp.getCycles());
+		logProcess(sim, done.proc, done.time, "Process " + pid + ": end memory blocking");
+	}
+	table.pc[done.proc]++;
+	stepProcess(sim, policy, done.proc);
+}
+
+template<class Policy>
+void finishIO(simState &sim, Policy &policy, SimEvent done){
+
+	simProcess &current = sim.procs[done.proc];
+	MetaObj &temp = currentOp(sim, done.proc);
+
+	if(current.io_data != NULL){
+		pthread_join(current.io_thread, NULL);
+		delete current.io_data;
+		current.io_data = NULL;
 	}
 
-	procOrganized = new int[procNum];	// Create array listing all the processes
-	for(int i = 0; i < procNum; i++){	// Number the array accordingly
-		procOrganized[i] = i + 1;
+	std::string msg = "Process " + std::to_string(sim.table.pid[done.proc]) + ": end " + temp.getDescription();
+	msg += (temp.getCode() == 'I') ? " input" : " output";
+	logProcess(sim, done.proc, done.time, msg);
+	spendKey(sim, done.proc, opTime(*sim.conf, temp), true);
+	sim.table.pc[done.proc]++;
+	sim.table.device[done.proc] = -1;
+	sim.table.unit[done.proc] = -1;
+
+	// Hand the unit straight to the next process waiting on it
+	if(done.device != -1){
+		devicePool &pool = sim.devices[done.device];
+		pool.busy[done.unit] = false;
+		if(!pool.waiting.empty()){
+			int next = pool.waiting.front();
+			pool.waiting.pop();
+			pool.busy[done.unit] = true;
+			pool.last = done.unit;
+			startIO(sim, next, done.device, done.unit);
+		}
+	}
+
+	makeReady(sim, policy, current.core, done.proc);
+}
+
+// Moves a scheduled workload to the end of the program and adds its
+// processes, numbered in order after the ones already loaded. Returns
+// the index of the first one
+int addProcesses(simState &sim, Workload &procInfo, int* org_procList){
+
+	int first = sim.procs.size();
+	int admitted = takePids(sim, procInfo);
+	sim.program.absorb(procInfo);
+	for(unsigned int proc = first; proc < sim.program.procs.size(); proc++){
+		int place = org_procList[proc - first];
+		if(!procInfo.places.empty())
+			place = procInfo.places[place - 1];
+		sim.procs.push_back(simProcess());
+		sim.table.add(admitted + place);
+		loadProcess(sim, proc);
 	}
+	return first;
+}
+
+// v6.0, pid before the first process of a workload. Pids carry on from
+// every process so far, the first part of a split file to arrive holds
+// them for the whole file and the later parts fill in their places
+int takePids(simState &sim, Workload &procInfo){
 
-	int schData[procNum]{};	// Used to track number of I/O
-	int sdCounter = -1;	// Need to start at -1, since first encountered P will raise to 0
+	int admitted = sim.pidsUsed;
+	if(procInfo.file == -1){
+		sim.pidsUsed += procInfo.procs.size();
+		return admitted;
+	}
+	if(procInfo.file >= (int)sim.fileBase.size())
+		sim.fileBase.resize(procInfo.file + 1, -1);
+	if(sim.fileBase[procInfo.file] == -1){
+		sim.fileBase[procInfo.file] = admitted;
+		sim.pidsUsed += procInfo.fileProcs;
+	}
+	return sim.fileBase[procInfo.file];
+}
 
-	if(schType == "FIFO"){
-		while(!q_temp_1.empty()){
-			procList.push(q_temp_1.front());
-			q_temp_1.pop();
+// Sets a newly added process up from its span of the program
+void loadProcess(simState &sim, int proc){
+
+	opSpan span = sim.program.procs[proc];
+	for(int i = span.begin; i < span.end; i++){
+		MetaObj &temp = sim.program.ops[i];
+		if(temp.isAttribute())
+			setAttribute(sim.procs[proc], temp);	// Process attributes set up the process, they do not run
+		else if(temp.getCode() == 'P')
+			sim.table.workLeft[proc] += sim.procT * temp.getCycles();
+		else if(temp.getCode() == 'M')
+			sim.table.workLeft[proc] += sim.memT * temp.getCycles();
+		if(temp.getCode() != 'A')
+			sim.table.keyLeft[proc] += opKey(sim, temp);
+	}
+}
+
+// Hands a removed streamed process's entry back for the stream to reuse.
+// Its operations stay in the program until it is compacted
+void releaseProcess(simState &sim, int proc){
+
+	opSpan &span = sim.program.procs[proc];
+	sim.deadOps += span.end - span.begin;
+	span = opSpan();
+	sim.freeSlots.push_back(proc);
+	sim.streamed--;
+}
+
+// Applies a process attribute from the meta data, an A operation
+// other than begin and finish
+void setAttribute(simProcess &current, MetaObj &attr){
+
+	switch(attr.getDesc()){
+	case DESC_NICE:
+		current.nice = attr.getCycles();
+		break;
+	case DESC_TICKETS:
+		current.tickets = attr.getCycles();
+		break;
+	case DESC_DEADLINE:
+		current.deadline = attr.getCycles();
+		break;
+	case DESC_PERIOD:
+		current.period = attr.getCycles();
+		break;
+	case DESC_PRIORITY:
+		current.priority = attr.getCycles();
+		break;
+	default:
+		break;	// A{arrival} is used before the process is added
+	}
+}
+
+// Puts a process that became ready in a core's ready queue, or in
+// the queue of the core the policy has it take over
+template<class Policy>
+void makeReady(simState &sim, Policy &policy, int core, int proc){
+
+	sim.table.setState(proc, READY, sim.clock->now());
+	int victim = policy.preemptTarget(sim, proc);
+	if(victim == -1){
+		sim.procs[proc].core = core;
+		policy.enqueue(sim, core, proc);
+		return;
+	}
+	sim.procs[proc].core = victim;
+	policy.enqueue(sim, victim, proc);
+	preemptCore(sim, policy, victim);
+}
+
+// Interrupts the processing action running on a core and puts its
+// process back in the ready queue. Returns false if the slice is
+// already over, its finished event is on the way
+template<class Policy>
+bool preemptCore(simState &sim, Policy &policy, int core){
+
+	coreState &self = sim.cores[core];
+	int proc = self.running;
+	simProcess &current = sim.procs[proc];
+	long long now = sim.clock->now();
+	long long elapsed = (now - self.busySince) / 1000;
+	if(elapsed >= current.sliceLen)
+		return false;
+
+	// Whatever the timer posts for this slice is stale now
+	current.sliceToken++;
+	if(!sim.clock->isVirtual())
+		cancelTimer(self.timer);
+
+	self.busy += now - self.busySince;
+	sim.table.opLeft[proc] -= elapsed;
+	sim.table.workLeft[proc] -= elapsed;
+	spendKey(sim, proc, elapsed, false);
+	policy.charge(sim, proc, elapsed);
+	logProcess(sim, proc, now, "Process " + std::to_string(sim.table.pid[proc]) + ": interrupt processing action");
+	sim.preemptions++;
+	sim.table.setState(proc, READY, now);
+	self.running = -1;
+	policy.enqueue(sim, core, proc);
+	return true;
+}
+
+// Processes from a reload of the meta data file join the simulation.
+// Only the new batch is scheduled, then each process goes straight into
+// the policy's ready structure, nothing already queued is touched
+template<class Policy>
+void admitArrival(simState &sim, Policy &policy, Workload* batch){
+
+	sim.arrivalsPending--;
+	if(batch == NULL)
+		return;
+
+	int* batchOrder;
+	schAlg(*batch, *sim.conf, batchOrder);
+	int first = addProcesses(sim, *batch, batchOrder);
+	delete[] batchOrder;
+	delete batch;
+
+	for(unsigned int proc = first; proc < sim.procs.size(); proc++){
+		sim.table.arrived[proc] = sim.clock->now();
+		sim.table.since[proc] = sim.table.arrived[proc];
+		policy.onArrival(sim, proc);
+		makeReady(sim, policy, sim.nextCore, proc);
+		sim.nextCore = (sim.nextCore + 1) % sim.cores.size();
+	}
+}
+
+// Fills the window from the meta data stream. Each take is scheduled on
+// its own, so SJF ranks by shortest job within the window it has read.
+// New processes take over the entries of removed ones first, and the
+// program is compacted once removed processes hold half its operations
+template<class Policy>
+void admitStream(simState &sim, Policy &policy){
+
+	Workload batch;
+	if(sim.stream->take(batch, sim.streamWindow - sim.streamed) == 0){
+		int lineCounter;
+		int readStatus = sim.stream->error(lineCounter);
+		if(readStatus){
+			std::string kinds[3] = {"Code", "Description", "Cycle"};
+			std::cout << kinds[readStatus - 1] << " error in line " << lineCounter << " of the meta data file" << std::endl;
 		}
+		sim.stream = NULL;
+		sim.arrivalsPending--;
 		return;
 	}
 
-	else if(schType == "PS"){
-		while(!q_temp_1.empty()){
-			if(q_temp_1.front().getCode() == 'S' || q_temp_1.front().getCode() == 'P' || q_temp_1.front().getCode() == 'M'){
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
-			else if(q_temp_1.front().getCode() == 'I' || q_temp_1.front().getCode() == 'O'){
-				schData[sdCounter]++;
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
-			else{
-				if(q_temp_1.front().getDescription() == "begin"){
-					sdCounter++;
-				}
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
+	if(sim.deadOps > sim.program.size() / 2){
+		sim.program.compact();
+		sim.deadOps = 0;
+	}
+
+	int* batchOrder;
+	schAlg(batch, *sim.conf, batchOrder);
+	int admitted = takePids(sim, batch);
+	for(unsigned int i = 0; i < batch.procs.size(); i++){
+		opSpan span = sim.program.append(batch, batch.procs[i]);
+		int proc;
+		if(sim.freeSlots.empty()){
+			proc = sim.procs.size();
+			sim.procs.push_back(simProcess());
+			sim.table.add(admitted + batchOrder[i]);
+			sim.program.procs.push_back(span);
 		}
-		// Organize the processes NUMBERS (sort largest to smallest)
-		for(int i = 0; i < procNum; i++){
-			for(int j = i + 1; j < procNum; j++){
-				if(schData[i] < schData[j]){
-					for(int k = j; k > i; k--){
-						std::swap(schData[k], schData[k - 1]);
-						std::swap(procOrganized[k], procOrganized[k - 1]);
-					}
-				}
-			}
+		else{
+			// Timer events of the old process may still come in, they
+			// must not match the new one's slices
+			proc = sim.freeSlots.back();
+			sim.freeSlots.pop_back();
+			long long token = sim.procs[proc].sliceToken + 1;
+			sim.procs[proc] = simProcess();
+			sim.procs[proc].sliceToken = token;
+			sim.table.reset(proc, admitted + batchOrder[i]);
+			sim.program.procs[proc] = span;
+			sim.recycled++;
 		}
+		loadProcess(sim, proc);
+		sim.procs[proc].streamed = true;
+		sim.streamed++;
+
+		sim.table.arrived[proc] = sim.clock->now();
+		sim.table.since[proc] = sim.table.arrived[proc];
+		policy.onArrival(sim, proc);
+		makeReady(sim, policy, sim.nextCore, proc);
+		sim.nextCore = (sim.nextCore + 1) % sim.cores.size();
 	}
-	else if(schType == "SJF"){
-		while(!q_temp_1.empty()){
-			if(q_temp_1.front().getCode() == 'S'){
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
-			else if(q_temp_1.front().getCode() == 'A'){
-				if(q_temp_1.front().getDescription() == "begin"){
-					sdCounter++;
-				}
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
-			else{
-				schData[sdCounter]++;
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
+	delete[] batchOrder;
+}
+
+// Next process for an idle core. When its own ready queue is empty
+// the core may steal from the longest other queue
+template<class Policy>
+int takeReady(simState &sim, Policy &policy, int core, bool steal){
+
+	int proc = policy.pickNext(sim, core);
+	if(proc != -1 || !steal)
+		return proc;
+
+	int victim = -1;
+	int longest = 0;
+	for(unsigned int i = 0; i < sim.cores.size(); i++){
+		if(policy.waiting(i) > longest){
+			longest = policy.waiting(i);
+			victim = i;
 		}
-		// Organize the processes NUMBERS (sort smallest to largest)
-		for(int i = 0; i < procNum; i++){
-			for(int j = i + 1; j < procNum; j++){
-				if(schData[j] < schData[i]){
-					for(int k = j; k > i; k--){
-						std::swap(schData[k], schData[k - 1]);
-						std::swap(procOrganized[k], procOrganized[k - 1]);
-					}
-				}
-			}
+	}
+	if(victim == -1)
+		return -1;
+
+	proc = policy.steal(sim, victim);
+	sim.procs[proc].core = core;
+	sim.cores[core].steals++;
+	return proc;
+}
+
+// Gives every idle core a ready process, returns true if any started.
+// Cores serve their own queues first so work is only stolen from
+// a core that is busy
+template<class Policy>
+bool dispatchIdle(simState &sim, Policy &policy){
+
+	for(int steal = 0; steal < 2; steal++){
+		for(unsigned int core = 0; core < sim.cores.size(); core++){
+			if(sim.cores[core].running != -1)
+				continue;
+			int proc = takeReady(sim, policy, core, steal);
+			if(proc == -1)
+				continue;
+			if(sim.cores[core].lastProc != -1 && sim.cores[core].lastProc != proc)
+				sim.contextSwitches++;
+			sim.cores[core].lastProc = proc;
+			sim.cores[core].running = proc;
+			sim.table.setState(proc, RUNNING, sim.clock->now());
+			stepProcess(sim, policy, proc);
+			return true;
 		}
 	}
+	return false;
+}
 
-	// v5.0
-	else if(schType == "RR"){
-		while(!q_temp_1.empty()){
-			if(q_temp_1.front().getCode() == 'S'){
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
-			else if(q_temp_1.front().getCode() == 'A'){
-				if(q_temp_1.front().getDescription() == "begin"){
-					sdCounter++;
-				}
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
-			else{
-				schData[sdCounter]++;
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
+// Prints how busy each core was and how often it had to steal work
+void coreReport(simState &sim, long long simEnd){
+
+	for(unsigned int core = 0; core < sim.cores.size(); core++){
+		double util = simEnd > 0 ? 100.0 * sim.cores[core].busy / simEnd : 0;
+		std::ostringstream line;
+		line << "Core " << core << ": busy " << std::fixed << std::setprecision(6) << sim.cores[core].busy / (double)1000000
+			<< " s, utilization " << std::setprecision(1) << util << "%, steals " << sim.cores[core].steals;
+		*sim.out1 << line.str() << std::endl;
+		*sim.out2 << line.str() << std::endl;
+	}
+}
+
+// Queueing delay under the generated load. Response is arrival to the
+// first run, ready is all the time spent in ready queues and turnaround
+// is arrival to removal
+void loadReport(simState &sim, LoadGen &gen, long long simEnd){
+
+	ProcTable &table = sim.table;
+	std::vector<long long> response, ready, turnaround;
+	for(int proc = 0; proc < table.size(); proc++){
+		if(table.started[proc] >= 0)
+			response.push_back(table.started[proc] - table.arrived[proc]);
+		if(table.removed[proc] >= 0){
+			ready.push_back(table.readyTime[proc]);
+			turnaround.push_back(table.removed[proc] - table.arrived[proc]);
 		}
-		// Organize the processes NUMBERS (sort smallest to largest)
-		for(int i = 0; i < procNum; i++){
-			for(int j = i + 1; j < procNum; j++){
-				if(schData[j] < schData[i]){
-					for(int k = j; k > i; k--){
-						std::swap(schData[k], schData[k - 1]);
-						std::swap(procOrganized[k], procOrganized[k - 1]);
-					}
-				}
-			}
+	}
+	std::sort(response.begin(), response.end());
+	std::sort(ready.begin(), ready.end());
+	std::sort(turnaround.begin(), turnaround.end());
+
+	std::ostringstream lines;
+	lines << std::fixed << std::setprecision(1) << "Load: " << gen.getTotal() << " generated processes, "
+		<< gen.getShape() << " at " << gen.getRate() << "/s offered, "
+		<< (simEnd > 0 ? sim.finished * 1000000.0 / simEnd : 0) << "/s completed, "
+		<< sim.procs.size() - sim.finished << " left unfinished" << std::endl;
+	std::string names[3] = {"Response", "Ready", "Turnaround"};
+	std::vector<long long>* samples[3] = {&response, &ready, &turnaround};
+	for(int i = 0; i < 3; i++){
+		std::vector<long long> &sorted = *samples[i];
+		long long sum = 0;
+		for(unsigned int j = 0; j < sorted.size(); j++){
+			sum += sorted[j];
 		}
+		lines << names[i] << ": mean " << (sorted.empty() ? 0 : sum / 1000.0 / sorted.size()) << " msec, median "
+			<< percentile(sorted, 0.5) / 1000.0 << " msec, 90th " << percentile(sorted, 0.9) / 1000.0 << " msec, 99th "
+			<< percentile(sorted, 0.99) / 1000.0 << " msec, max " << (sorted.empty() ? 0 : sorted.back() / 1000.0) << " msec" << std::endl;
 	}
+	*sim.out1 << lines.str();
+	*sim.out2 << lines.str();
+}
 
-	else if(schType == "STR"){
-		while(!q_temp_1.empty()){
-			if(q_temp_1.front().getCode() == 'S'){
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
-			else if(q_temp_1.front().getCode() == 'A'){
-				if(q_temp_1.front().getDescription() == "begin"){
-					sdCounter++;
-				}
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
-			else{
-				schData[sdCounter]++;
-				q_temp_2.push(q_temp_1.front());
-				q_temp_1.pop();
-			}
+// Virtual clock, makes the generator's next process and schedules its
+// arrival. The one after is only made once this one arrives
+void scheduleGenerated(simState &sim, LoadGen &gen){
+
+	SimEvent arrived;
+	arrived.type = EV_GENERATED;
+	long long due = gen.nextAt();
+	arrived.batch = gen.generate();
+	sim.events->schedule(arrived, due - sim.clock->now() / 1000);
+}
+
+// v6.0, processes take turns on the processor cores. A process that
+// starts I/O gives its core to the next ready process while its device
+// works, and goes back in its core's ready queue when the I/O finishes.
+// Which ready process goes next is up to the scheduling policy
+template<class Policy>
+void procSim(ConfData &timeConf, Workload &procInfo, std::vector<arrivalLoad> &plan, MdfStream* stream, SimClock &simClock, std::ostream& out1, std::ostream& out2, int* org_procList){
+
+	simState sim;
+	sim.monT = timeConf.getCycleTime("Monitor");
+	sim.procT = timeConf.getCycleTime("Processor");
+	sim.scanT = timeConf.getCycleTime("Scanner");
+	sim.hdT = timeConf.getCycleTime("Hard Drive");
+	sim.keyT = timeConf.getCycleTime("Keyboard");
+	sim.memT = timeConf.getCycleTime("Memory");
+	sim.projT = timeConf.getCycleTime("Projector");
+	sim.max_mem = timeConf.getMem();
+	sim.last_mem_addr = -1;
+	sim.mem_block = timeConf.getMemBlock();
+	sim.out1 = &out1;
+	sim.out2 = &out2;
+	sim.conf = &timeConf;
+	sim.timeKey = timeConf.get_sch_key(timeConf.get_sch()) == "Time";
+
+	// Split the scheduled workload into its processes
+	addProcesses(sim, procInfo, org_procList);
+
+	int numUnits[2] = {timeConf.getNumHDD(), timeConf.getNumProj()};
+	std::string unitNames[2] = {"HDD", "PROJ"};
+	for(int dev = 0; dev < 2; dev++){
+		sim.devices[dev].name = unitNames[dev];
+		sim.devices[dev].busy.assign(numUnits[dev], false);
+		sim.devices[dev].unit_lock.resize(numUnits[dev]);
+		sem_init(&sim.devices[dev].free_units, 0, numUnits[dev]);
+		for(int unit = 0; unit < numUnits[dev]; unit++){
+			pthread_mutex_init(&sim.devices[dev].unit_lock[unit], NULL);
 		}
-		// Organize the processes NUMBERS (sort smallest to largest)
-		for(int i = 0; i < procNum; i++){
-			for(int j = i + 1; j < procNum; j++){
-				if(schData[j] < schData[i]){
-					for(int k = j; k > i; k--){
-						std::swap(schData[k], schData[k - 1]);
-						std::swap(procOrganized[k], procOrganized[k - 1]);
-					}
-				}
-			}
+	}
+
+	// Time zero of the log. A virtual clock has no need
+	// for the timer thread since it jumps straight to each event
+	simClock.start();
+	EventQueue events(&simClock);
+	sim.clock = &simClock;
+	sim.events = &events;
+
+	// One timer per core, the cores never move in memory after this
+	int numCores = timeConf.get_cores();
+	sim.cores.resize(numCores);
+	for(int core = 0; core < numCores; core++){
+		timerPackage &p1 = sim.cores[core].timer;
+		p1.clock = &simClock;
+		p1.events = &events;
+		pthread_mutex_init(&p1.timer_lock, NULL);
+		pthread_condattr_t monotonic;
+		pthread_condattr_init(&monotonic);
+		pthread_condattr_setclock(&monotonic, CLOCK_MONOTONIC);
+		pthread_cond_init(&p1.timer_request, &monotonic);
+		pthread_condattr_destroy(&monotonic);
+
+		// New thread dedicated towards timing
+		if(!simClock.isVirtual())
+			pthread_create(&sim.cores[core].timer_thread, NULL, timerThreadFunc, (void *) &p1);
+	}
+
+	Policy policy;
+	policy.setup(sim, timeConf);
+
+	logEvent(sim, simClock.now(), "Simulator program starting");
+
+	// Deal the processes out to the cores in scheduling order
+	for(unsigned int i = 0; i < sim.procs.size(); i++){
+		policy.onArrival(sim, i);
+		sim.table.setState(i, READY, 0);
+		sim.procs[i].core = sim.nextCore;
+		policy.enqueue(sim, sim.nextCore, i);
+		sim.nextCore = (sim.nextCore + 1) % numCores;
+	}
+
+	// v5.0, simulate process arrival. Every arrival was loaded up front,
+	// the virtual clock schedules each one, the real clock has a thread
+	// that pushes each one to the arrival queue when its time comes
+	ArrivalQueue arrivals;
+	new_proc_data newProcData;
+	newProcData.plan = &plan;
+	newProcData.clock = &simClock;
+	newProcData.events = &events;
+	newProcData.arrivals = &arrivals;
+	pthread_t add_proc, gen_proc;
+
+	// v6.0, the load generator makes its processes as they arrive
+	LoadGen gen;
+	gen.setup(timeConf);
+	newProcData.gen = &gen;
+
+	sim.arrivalsPending = plan.size() + gen.getTotal();
+
+	// v6.0, the stream counts as one arrival until it has been read
+	sim.stream = stream;
+	sim.streamWindow = timeConf.get_stream_window();
+	if(stream != NULL)
+		sim.arrivalsPending++;
+	if(simClock.isVirtual()){
+		for(unsigned int i = 0; i < plan.size(); i++){
+			SimEvent arrived;
+			arrived.type = EV_ARRIVAL;
+			arrived.batch = plan[i].batch;
+			events.schedule(arrived, plan[i].at);
 		}
+		if(gen.more())
+			scheduleGenerated(sim, gen);
+	}
+	else{
+		pthread_create(&add_proc, NULL, proc_arrival, (void *) &newProcData);
+		pthread_create(&gen_proc, NULL, proc_generate, (void *) &newProcData);
 	}
 
-	// Actual process re-organization
-	std::vector<std::queue<MetaObj>> procDivide;
-	std::queue<MetaObj> mo_temp;
-	while(!q_temp_2.empty()){
-		if(q_temp_2.front().getCode() == 'S'){
-			if(q_temp_2.front().getDescription() == "begin"){
-				procList.push(q_temp_2.front());
-				q_temp_2.pop();
-			}
-			else{
-				procDivide.push_back(mo_temp);
-				while(!mo_temp.empty()){
-					mo_temp.pop();
-				}
-				mo_temp.push(q_temp_2.front());
-				q_temp_2.pop();
-				procDivide.push_back(mo_temp);
-			}
+	while(sim.finished < (int)sim.procs.size() + sim.recycled || sim.arrivalsPending > 0){
+
+		// v6.0, the stream refills the window once half of it is removed
+		if(sim.stream != NULL && sim.streamed <= sim.streamWindow / 2)
+			admitStream(sim, policy);
+
+		// Idle cores take the next ready process
+		if(dispatchIdle(sim, policy))
+			continue;
+
+		// Nothing left that could wake a process. On the real clock
+		// the load thread rings for arrivals that are still to come
+		if(events.empty() && (simClock.isVirtual() || sim.arrivalsPending == 0))
+			break;
+
+		SimEvent done = events.next();
+		if(done.type == EV_CPU_DONE)
+			finishCPU(sim, policy, done);
+		else if(done.type == EV_IO_DONE)
+			finishIO(sim, policy, done);
+		else if(done.type == EV_GENERATED){
+			admitArrival(sim, policy, done.batch);
+			if(gen.more())
+				scheduleGenerated(sim, gen);
 		}
-		else if(q_temp_2.front().getCode() == 'A'){
-			if(q_temp_2.front().getDescription() == "finish"){
-				mo_temp.push(q_temp_2.front());
-				q_temp_2.pop();
-				procDivide.push_back(mo_temp);
-				while(!mo_temp.empty()){
-					mo_temp.pop();
-				}
-			}
-			else{
-				mo_temp.push(q_temp_2.front());
-				q_temp_2.pop();
+		else if(simClock.isVirtual())
+			admitArrival(sim, policy, done.batch);
+		else{
+			// Clear the doorbell first, a load pushed after this rings again
+			Workload* batch;
+			arrivals.clearDoorbell();
+			while(arrivals.pop(batch)){
+				admitArrival(sim, policy, batch);
 			}
 		}
-		else{
-			mo_temp.push(q_temp_2.front());
-			q_temp_2.pop();
+	}
+
+	long long simEnd = simClock.now();
+	logEvent(sim, simEnd, "Simulator program ending");
+
+	if(!simClock.isVirtual()){
+		pthread_join(add_proc, NULL);
+		pthread_join(gen_proc, NULL);
+	}
+
+	// Alert timer threads to stop, since process is ending
+	for(int core = 0; core < numCores; core++){
+		timerPackage &p1 = sim.cores[core].timer;
+		pthread_mutex_lock(&p1.timer_lock);
+		p1.contRun = false;
+		pthread_cond_signal(&p1.timer_request);
+		pthread_mutex_unlock(&p1.timer_lock);
+
+		if(!simClock.isVirtual())
+			pthread_join(sim.cores[core].timer_thread, NULL);
+		pthread_cond_destroy(&p1.timer_request);
+		pthread_mutex_destroy(&p1.timer_lock);
+	}
+
+	if(numCores > 1)
+		coreReport(sim, simEnd);
+	if(Policy::PREEMPTIVE || sim.preemptions > 0){
+		out1 << "Context switches: " << sim.contextSwitches << ", preemptions: " << sim.preemptions << std::endl;
+		out2 << "Context switches: " << sim.contextSwitches << ", preemptions: " << sim.preemptions << std::endl;
+	}
+	policy.report(sim);
+	if(gen.getTotal() > 0)
+		loadReport(sim, gen, simEnd);
+	if(!simClock.isVirtual())
+		simTimer.report(out1, out2);
+
+	for(int dev = 0; dev < 2; dev++){
+		sem_destroy(&sim.devices[dev].free_units);
+		for(int unit = 0; unit < numUnits[dev]; unit++){
+			pthread_mutex_destroy(&sim.devices[dev].unit_lock[unit]);
+		}
+	}
+}
+
+// v6.0, true if the simulator was built with a policy for the code
+bool schKnown(std::string schType){
+
+#define SCH_KNOWN(code, policy) if(schType == code) return true;
+	SCH_POLICIES(SCH_KNOWN)
+#undef SCH_KNOWN
+	return false;
+}
+
+// v6.0, true if the policy for the code can take a meta data stream
+bool schStreams(std::string schType){
+
+#define SCH_STREAMS(code, policy) if(schType == code) return policy::STREAMS;
+	SCH_POLICIES(SCH_STREAMS)
+#undef SCH_STREAMS
+	return false;
+}
+
+// v6.0, runs the simulator loop built for the configured policy. The
+// code is only looked up here, never inside the loop
+void runPolicy(ConfData &timeConf, Workload &procInfo, std::vector<arrivalLoad> &plan, MdfStream* stream, SimClock &simClock, std::ostream& out1, std::ostream& out2, int* org_procList){
+
+	std::string schType = timeConf.get_sch();
+#define SCH_RUN(code, policy) \
+	if(schType == code){ \
+		procSim<policy>(timeConf, procInfo, plan, stream, simClock, out1, out2, org_procList); \
+		return; \
+	}
+	SCH_POLICIES(SCH_RUN)
+#undef SCH_RUN
+}
+
+// v6.0, orders the processes by sorting one key per process and then
+// their spans, no operation is moved or copied. The key counts
+// operations, or with the Time scheduling key adds up their estimated msec
+void schAlg(Workload &procList, ConfData &schConf, int *&procOrganized){
+
+	std::string schType = schConf.get_sch();
+	bool timeKey = schConf.get_sch_key(schType) == "Time";
+
+	int procNum = procList.procs.size();
+	std::vector<schKey> keys(procNum);	// Sort key of each process
+	for(int proc = 0; proc < procNum; proc++){
+		keys[proc].proc = proc + 1;
+		opSpan span = procList.procs[proc];
+		for(int i = span.begin; i < span.end; i++){
+			MetaObj &temp = procList.ops[i];
+			char code = temp.getCode();
+			if(code == 'A' && temp.getDesc() == DESC_PRIORITY)
+				keys[proc].priority = temp.getCycles();
+			// PS breaks priority ties by I/O operations, SJF and STR rank by all operations
+			else if(code != 'A'){
+				if(schType != "PS" || code == 'I' || code == 'O')
+					keys[proc].key += timeKey ? opTime(schConf, temp) : 1;
+			}
 		}
 	}
-		for(int i = 0; i < procNum; i++){
-		while(!procDivide[procOrganized[i] - 1].empty()){
-			procList.push(procDivide[procOrganized[i] - 1].front());
-			procDivide[procOrganized[i] - 1].pop();
+
+	// v6.0, Round Robin takes processes in arrival order, the
+	// quantum is enforced by procSim
+	if(schType == "PS")
+		std::stable_sort(keys.begin(), keys.end(), mostKey);	// Largest to smallest
+	else if(schType == "SJF" || schType == "STR")
+		std::stable_sort(keys.begin(), keys.end(), leastKey);	// Smallest to largest
+
+	procOrganized = new int[procNum];	// Create array listing all the processes
+	std::vector<opSpan> organized(procNum);
+	for(int i = 0; i < procNum; i++){
+		procOrganized[i] = keys[i].proc;
+		organized[i] = procList.procs[keys[i].proc - 1];
+	}
+	procList.procs.swap(organized);
+}
+
+// v6.0, estimated msec an operation takes, 0 for A and S
+int opTime(ConfData &timeConf, MetaObj &op){
+
+	std::string device;
+	if(op.getCode() == 'P')
+		device = "Processor";
+	else if(op.getCode() == 'M')
+		device = "Memory";
+	else{
+		switch(op.getDesc()){
+		case DESC_HARD_DRIVE:
+			device = "Hard Drive";
+			break;
+		case DESC_KEYBOARD:
+			device = "Keyboard";
+			break;
+		case DESC_SCANNER:
+			device = "Scanner";
+			break;
+		case DESC_MONITOR:
+			device = "Monitor";
+			break;
+		case DESC_PROJECTOR:
+			device = "Projector";
+			break;
+		default:
+			return 0;
 		}
 	}
-	procList.push(procDivide.back().front());
+	return timeConf.getCycleTime(device) * op.getCycles();
+}
+
+// v6.0, what an operation adds to its process's scheduling key, counted
+// the way schAlg ranks SJF and STR
+long long opKey(simState &sim, MetaObj &op){
+	return sim.timeKey ? opTime(*sim.conf, op) : 1;
+}
+
+// v6.0, takes msec of work off the scheduling key left of a process,
+// or the whole operation once it is over when the key counts operations
+void spendKey(simState &sim, int proc, long long msec, bool opOver){
+	if(sim.timeKey)
+		sim.table.keyLeft[proc] -= msec;
+	else if(opOver)
+		sim.table.keyLeft[proc]--;
+}
+
+bool leastKey(const schKey &a, const schKey &b){
+	return a.key < b.key;
+}
+
+bool mostKey(const schKey &a, const schKey &b){
+	if(a.priority != b.priority)
+		return a.priority > b.priority;
+	return a.key > b.key;
 }
 
 // v5.0
+// v6.0, hands each planned load to the simulator as newly arrived
+// processes at its time. Waits are measured from the start of the
+// simulation, so lateness of one wake up does not carry over
 void* proc_arrival(void* casted_data){
 
 	new_proc_data* temp = (new_proc_data*)casted_data;
-	std::ifstream fin;
-	fin.open(temp->file_name);
-	std::string read_in_data;
-
-	for(int i = 0; i < 10; i++){
-		int readStatus = 0;
-		while(!readStatus){
-			if(!getline(fin, read_in_data) || !read_in_data.compare("End Program Meta-Data Code."))
-				readStatus = 4;	// Done reading
-			else
-				readStatus = mdfParse(read_in_data, *(temp->existing_proc_list));
+
+	for(unsigned int i = 0; i < temp->plan->size(); i++){
+		arrivalLoad &load = (*temp->plan)[i];
+		long long wait = load.at - temp->clock->now() / 1000;
+		if(wait > 0)
+			simWait(temp->clock, wait);
+
+		temp->arrivals->push(load.batch);
+
+		if(temp->arrivals->claimDoorbell()){
+			SimEvent bell;
+			bell.type = EV_ARRIVAL;
+			temp->events->ring(bell);
+		}
+	}
+	return casted_data;
+}
+
+// v6.0, hands the load generator's processes to the simulator as each
+// one is due, waits are measured from the start like proc_arrival
+void* proc_generate(void* casted_data){
+
+	new_proc_data* temp = (new_proc_data*)casted_data;
+
+	while(temp->gen->more()){
+		long long wait = temp->gen->nextAt() - temp->clock->now() / 1000;
+		if(wait > 0)
+			simWait(temp->clock, wait);
+
+		temp->arrivals->push(temp->gen->generate());
+
+		if(temp->arrivals->claimDoorbell()){
+			SimEvent bell;
+			bell.type = EV_ARRIVAL;
+			temp->events->ring(bell);
 		}
-		waitTime(100);
 	}
-	fin.close();
-	std::cout << "DEBUG: New process should be added now" << std::endl;
 	return casted_data;
-}
\ No newline at end of file
+}
+
+// v6.0, moves every process with an A{arrival} out of a workload loaded
+// at msec into a load of its own, at msec plus its arrival. Processes
+// with the same arrival share a load, in the order they were in. Every
+// part of the file is tagged with it, so a process keeps the pid of its
+// place in the file wherever it ends up
+void splitArrivals(Workload &procInfo, int file, long long at, std::vector<arrivalLoad> &plan){
+
+	std::vector<opSpan> stays;
+	std::vector<int> stayPlaces;
+	std::map<long long, Workload*> later;
+	for(unsigned int proc = 0; proc < procInfo.procs.size(); proc++){
+		opSpan span = procInfo.procs[proc];
+		long long delay = 0;
+		for(int i = span.begin; i < span.end; i++){
+			if(procInfo.ops[i].getCode() == 'A' && procInfo.ops[i].getDesc() == DESC_ARRIVAL)
+				delay = procInfo.ops[i].getCycles();
+		}
+		if(delay == 0){
+			stays.push_back(span);
+			stayPlaces.push_back(proc + 1);
+			continue;
+		}
+		if(later.find(delay) == later.end()){
+			later[delay] = new Workload;
+			later[delay]->file = file;
+			later[delay]->fileProcs = procInfo.procs.size();
+		}
+		later[delay]->take(procInfo, span);
+		later[delay]->places.push_back(proc + 1);
+	}
+	if(later.empty())
+		return;
+	procInfo.file = file;
+	procInfo.fileProcs = procInfo.procs.size();
+	procInfo.procs.swap(stays);
+	procInfo.places.swap(stayPlaces);
+
+	for(std::map<long long, Workload*>::iterator it = later.begin(); it != later.end(); it++){
+		arrivalLoad load;
+		load.at = at + it->first;
+		load.batch = it->second;
+		plan.push_back(load);
+	}
+}
+
+// v6.0, loads every Arrival File Path of the config, or reloads the
+// meta data file as many times as Meta-Data reloads asks when there are
+// none and it is not streamed, and sorts the plan by arrival. Returns
+// false if an arrival file will not load
+bool planArrivals(ConfData &cfgd, std::vector<arrivalLoad> &plan){
+
+	std::vector<arrivalLoad> loads;
+	if(cfgd.get_arrivals() == 0 && cfgd.get_stream_window() == 0){
+		for(int i = 1; i <= cfgd.get_reloads(); i++){
+			arrivalLoad load;
+			load.at = i * cfgd.get_reload_interval();
+			loads.push_back(load);
+		}
+	}
+	for(int i = 0; i < cfgd.get_arrivals(); i++){
+		arrivalLoad load;
+		load.at = cfgd.get_arrival_at(i);
+		loads.push_back(load);
+	}
+
+	for(unsigned int i = 0; i < loads.size(); i++){
+		std::string fileName = cfgd.get_arrivals() == 0 ? cfgd.getFilePath() : cfgd.get_arrival_path(i);
+		if(fileName.length() < 4 || fileName.substr(fileName.length() - 4) != ".mdf"){
+			std::cout << "Error: arrival file " << fileName << " should have .mdf extension" << std::endl;
+			return false;
+		}
+
+		Workload* batch = new Workload;
+		int lineCounter = 0;
+		int readStatus = mdfLoad(fileName, *batch, lineCounter);
+		if(readStatus != 0){
+			delete batch;
+			if(readStatus == 5)
+				std::cout << "Error: arrival file " << fileName << " not found" << std::endl;
+			else if(readStatus >= 6)
+				std::cout << "Error: bad start of arrival file " << fileName << std::endl;
+			else{
+				std::string kinds[3] = {"Code", "Description", "Cycle"};
+				std::cout << kinds[readStatus - 1] << " error in line " << lineCounter << " of arrival file " << fileName << std::endl;
+			}
+			return false;
+		}
+
+		splitArrivals(*batch, i + 1, loads[i].at, plan);
+		loads[i].batch = batch;
+		plan.push_back(loads[i]);
+	}
+
+	std::stable_sort(plan.begin(), plan.end(), earlierLoad);
+	return true;
+}
+
+// Orders the plan by arrival time, loads at the same time keep the
+// order they were planned in
+bool earlierLoad(const arrivalLoad &a, const arrivalLoad &b){
+	return a.at < b.at;
+}